@@ -0,0 +1,69 @@
+#include <esp8266channel3lib.h>
+/* 
+    ESP8266 Channel 3 frame pacing
+
+    Draws more and more spheres every frame until the frame callback
+    takes longer than a frame. The governor then drops to 30 Hz (25 Hz
+    with PAL) and 20 Hz (16.7 Hz), every image stays on screen for the
+    same number of frames instead of tearing. When it does, the sketch
+    draws less again. The render time and frame rate are shown on screen
+    and printed on the serial port (115200 baud).
+*/
+
+#define MAX_SPHERES 16
+
+int spheres = 1;
+int angle = 0;
+char status[40];
+
+// Told by the governor, the frame callback runs every divisor-th frame now
+void frameRate(uint8_t divisor) {
+  Serial.printf("divisor %d with %d spheres\n", divisor, spheres);
+  if (divisor > 1 && spheres > 1) spheres /= 2;
+}
+
+// This callback gets called automatically every frame the governor lets through
+void ICACHE_FLASH_ATTR loadFrame() {
+  video_broadcast_clear_frame();
+
+  tdIdentity(ProjectionMatrix);
+  Perspective(600, 250, 50, 8192, ProjectionMatrix);
+  CNFGColor(C3_COL_WHITE);
+  for (int i = 0; i < spheres; i++) {
+    tdIdentity(ModelviewMatrix);
+    tdTranslate(ModelviewMatrix, ((i % 4) - 2) * 90 + 45, ((i / 4) - 2) * 60 + 30, 600);
+    tdRotateEA(ModelviewMatrix, angle, angle + i * 16, 0);
+    DrawGeoSphere();
+  }
+  angle++;
+
+  CNFGColor(C3_COL_DD_WHITE);
+  CNFGPenX = 4;
+  CNFGPenY = 4;
+  CNFGDrawText(status, 2);
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+
+  channel3Init(NTSC /* or PAL */, &loadFrame);
+  channel3SetGovernor(3, &frameRate);
+}
+
+void loop() {
+  static uint32_t lastStep = 0;
+  if (millis() - lastStep < 1000) {
+    return;
+  }
+  lastStep = millis();
+
+  const channel3FrameStats_t *stats = channel3GetFrameStats(1);
+  snprintf(status, sizeof(status), "%d x %u us %u.%02u fps", spheres, stats->renderAvgUs,
+    stats->fps100 / 100, stats->fps100 % 100);
+  Serial.printf("spheres %d render %u us (max %u), %u.%02u fps, divisor %d, overruns %u\n", spheres,
+    stats->renderAvgUs, stats->renderMaxUs, stats->fps100 / 100, stats->fps100 % 100, stats->divisor, stats->overruns);
+
+  // More load while the full frame rate holds
+  if (stats->divisor == 1 && spheres < MAX_SPHERES) spheres++;
+}
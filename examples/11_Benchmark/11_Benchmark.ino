@@ -0,0 +1,158 @@
+#include <esp8266channel3lib.h>
+/*
+    ESP8266 Channel 3 benchmark
+
+    Times the math and drawing primitives over fixed workloads and prints
+    one CSV line per benchmark on the serial port (115200 baud):
+
+        c3bench,<name>,<iterations>,<cycles>,<cycles per iteration>,<us>
+
+    preceded by a c3bench,meta line with the platform and CPU clock. Keep
+    the output of a release to compare the next one against it. The video
+    interrupt keeps running while this is measured, so the numbers include
+    its overhead.
+
+    tools/host builds the same sketch for the PC (make -C tools/host bench),
+    where the cycles are the time measured with std::chrono converted to
+    cycles at the same clock.
+*/
+
+#define PIXEL_ROUNDS 4
+#define CLEAR_ROUNDS 100
+#define MATH_ROUNDS 2000
+#define LINE_ROUNDS 500
+#define RECT_ROUNDS 20
+#define TEXT_ROUNDS 10
+#define NOISE_ROUNDS 1000
+#define SPHERE_ROUNDS 20
+
+static const char page[] =
+  "ESP8266 Channel 3 benchmark\n"
+  "The quick brown fox jumps over\n"
+  "the lazy dog. 0123456789 !?#%&\n"
+  "THE QUICK BROWN FOX JUMPS OVER\n"
+  "THE LAZY DOG. ()[]{}<>+-*/=:;,.\n"
+  "Status: OK    Temp: 23.5C\n"
+  "Uptime: 12:34:56  Frames: 4711\n"
+  "abcdefghijklmnopqrstuvwxyz\n"
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZ\n";
+
+static int16_t matA[16], matB[16], matC[16];
+static int16_t point[4] = { 100, -50, 300, 256 };
+static int16_t outPoint[4];
+static volatile int32_t sink;
+
+// --- Workloads, i is the iteration ---
+static void benchPixels(int i) {
+  int w = video_broadcast_framebuffer_width() / 2;
+  int h = video_broadcast_framebuffer_height();
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      video_broadcast_tack_pixel(x, y, (x + y + i) & 15);
+    }
+  }
+}
+
+static void benchClear(int i) {
+  (void)i;
+  video_broadcast_clear_frame();
+}
+
+static void benchMultiply(int i) {
+  matB[3] = i;
+  tdMultiply(matA, matB, matC);
+}
+
+static void bench4Transform(int i) {
+  point[0] = i & 255;
+  td4Transform(point, matA, outPoint);
+}
+
+static void benchScreenspace(int i) {
+  int16_t x, y;
+  point[0] = (i & 255) - 128;
+  LocalToScreenspace(point, &x, &y);
+  sink += x + y;
+}
+
+static void benchSegment(int i) {
+  // A fan over the whole screen, every angle and length
+  int w = video_broadcast_framebuffer_width() / 2;
+  int h = video_broadcast_framebuffer_height();
+  CNFGColor(C3_COL_WHITE);
+  CNFGTackSegment(w / 2, h / 2, (i * 7) % w, (i * 13) % h);
+}
+
+static void benchRectangle(int i) {
+  CNFGColor((i & 7) + 1);
+  CNFGTackRectangle(0, 0, video_broadcast_framebuffer_width() / 2 - 1, video_broadcast_framebuffer_height() - 1);
+}
+
+static void benchText(int i) {
+  (void)i;
+  CNFGColor(C3_COL_DD_WHITE);
+  CNFGPenX = 2;
+  CNFGPenY = 2;
+  CNFGDrawText(page, 2);
+}
+
+static void benchPerlin(int i) {
+  sink += tdPerlin2D(i * 37, i * 11);
+}
+
+static void benchGeoSphere(int i) {
+  tdIdentity(ModelviewMatrix);
+  tdTranslate(ModelviewMatrix, 0, 0, 700);
+  tdRotateEA(ModelviewMatrix, i * 3, i * 5, 0);
+  CNFGColor(C3_COL_WHITE);
+  DrawGeoSphere();
+}
+
+static void bench(const char *name, int iterations, void (*work)(int)) {
+  uint32_t start = ESP.getCycleCount();
+  for (int i = 0; i < iterations; i++) {
+    work(i);
+  }
+  uint32_t cycles = ESP.getCycleCount() - start;
+  Serial.printf("c3bench,%s,%d,%u,%u,%u\n", name, iterations, cycles, cycles / iterations,
+    cycles / system_get_cpu_freq());
+  yield();
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+  channel3Init(NTSC, NULL);
+  delay(100);
+
+#ifdef C3_HOST
+  const char *platform = "host";
+#else
+  const char *platform = "esp8266";
+#endif
+  Serial.printf("c3bench,meta,%s,%u\n", platform, system_get_cpu_freq());
+
+  tdIdentity(matA);
+  tdRotateEA(matA, 10, 20, 30);
+  tdIdentity(matB);
+  tdTranslate(matB, 5, 6, 7);
+  tdIdentity(ProjectionMatrix);
+  Perspective(600, 250, 50, 8192, ProjectionMatrix);
+  tdIdentity(ModelviewMatrix);
+  tdTranslate(ModelviewMatrix, 0, 0, 700);
+
+  bench("pixel_fullscreen", PIXEL_ROUNDS, benchPixels);
+  bench("clear_frame", CLEAR_ROUNDS, benchClear);
+  bench("tdMultiply", MATH_ROUNDS, benchMultiply);
+  bench("td4Transform", MATH_ROUNDS, bench4Transform);
+  bench("LocalToScreenspace", MATH_ROUNDS, benchScreenspace);
+  bench("CNFGTackSegment_fan", LINE_ROUNDS, benchSegment);
+  bench("CNFGTackRectangle_fullscreen", RECT_ROUNDS, benchRectangle);
+  bench("CNFGDrawText_page", TEXT_ROUNDS, benchText);
+  bench("tdPerlin2D", NOISE_ROUNDS, benchPerlin);
+  bench("DrawGeoSphere", SPHERE_ROUNDS, benchGeoSphere);
+  Serial.printf("c3bench,done\n");
+}
+
+void loop() {
+}
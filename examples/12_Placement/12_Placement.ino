@@ -0,0 +1,140 @@
+#include <esp8266channel3lib.h>
+/*
+    ESP8266 Channel 3 code placement
+
+    Shows what flash cache misses cost the drawing code. Every workload is
+    run right after the instruction cache was flushed by reading 64 kB of
+    flash (cold) and again with the cache filled by the run before (warm):
+
+        c3place,<name>,<iram|flash>,<cold cycles>,<warm cycles>,<miss cycles>
+
+    The second column is where the function ended up. Build it once per
+    profile, the whole library has to see the same setting, e.g. in
+    platformio.ini
+
+        build_flags = -DC3_PLACEMENT_PROFILE=0    ; C3_PLACE_MIN_IRAM
+        build_flags = -DC3_PLACEMENT_PROFILE=1    ; C3_PLACE_BALANCED, the default
+        build_flags = -DC3_PLACEMENT_PROFILE=2    ; C3_PLACE_MAX_SPEED
+
+    and compare the miss column. The frame callback is cold in the same way
+    whenever Wi-Fi or the sketch ran in between.
+*/
+
+#define ROUNDS 16
+#define EVICT_BYTES 65536
+#define CACHE_LINE 32
+
+static const uint8_t evictBlock[EVICT_BYTES] PROGMEM = { 1 };
+static int16_t matA[16], matB[16], matC[16];
+static int16_t point[3] = { 100, -50, 300 };
+static volatile int32_t sink;
+
+// Reads more flash than the cache holds, so the code run next starts cold
+static void evictCache() {
+  uint32_t sum = 0;
+  for (int i = 0; i < EVICT_BYTES; i += CACHE_LINE) {
+    sum += pgm_read_byte(&evictBlock[i]);
+  }
+  sink += sum;
+}
+
+// --- Workloads ---
+static void runPixels() {
+  for (int x = 0; x < 64; x++) {
+    video_broadcast_tack_pixel(x, 10, C3_COL_WHITE);
+  }
+}
+
+static void runSegment() {
+  CNFGColor(C3_COL_WHITE);
+  CNFGTackSegment(4, 4, 100, 60);
+}
+
+static void runMultiply() {
+  tdMultiply(matA, matB, matC);
+}
+
+static void runPTransform() {
+  int16_t out[3];
+  tdPTransform(point, matA, out);
+  sink += out[0];
+}
+
+static void runScreenspace() {
+  int16_t x, y;
+  LocalToScreenspace(point, &x, &y);
+  sink += x + y;
+}
+
+static void runRectangle() {
+  CNFGColor(C3_COL_RED);
+  CNFGTackRectangle(10, 10, 25, 25);
+}
+
+static void runText() {
+  CNFGColor(C3_COL_DD_WHITE);
+  CNFGPenX = 2;
+  CNFGPenY = 120;
+  CNFGDrawText("Temp 23.5C", 2);
+}
+
+static void runPerlin() {
+  sink += tdPerlin2D(1234, 567);
+}
+
+static void runGeoSphere() {
+  CNFGColor(C3_COL_WHITE);
+  DrawGeoSphere();
+}
+
+static void measure(const char *name, void *fn, void (*work)()) {
+  uint32_t cold = 0;
+  uint32_t warm = 0;
+  for (int i = 0; i < ROUNDS; i++) {
+    evictCache();
+    uint32_t start = ESP.getCycleCount();
+    work();
+    uint32_t middle = ESP.getCycleCount();
+    work();
+    uint32_t end = ESP.getCycleCount();
+    cold += middle - start;
+    warm += end - middle;
+    yield();
+  }
+  cold /= ROUNDS;
+  warm /= ROUNDS;
+  // Instruction RAM is mapped at 0x40100000, the flash cache from 0x40200000
+  const char *where = ((uint32_t)fn < 0x40200000) ? "iram" : "flash";
+  Serial.printf("c3place,%s,%s,%u,%u,%d\n", name, where, cold, warm, (int)(cold - warm));
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+  channel3Init(NTSC, NULL);
+  delay(100);
+  Serial.printf("c3place,meta,%s,%u\n", C3_PLACEMENT_NAME, system_get_cpu_freq());
+
+  tdIdentity(matA);
+  tdRotateEA(matA, 10, 20, 30);
+  tdIdentity(matB);
+  tdTranslate(matB, 5, 6, 7);
+  tdIdentity(ProjectionMatrix);
+  Perspective(600, 250, 50, 8192, ProjectionMatrix);
+  tdIdentity(ModelviewMatrix);
+  tdTranslate(ModelviewMatrix, 0, 0, 700);
+
+  measure("video_broadcast_tack_pixel", (void *)video_broadcast_tack_pixel, runPixels);
+  measure("CNFGTackSegment", (void *)CNFGTackSegment, runSegment);
+  measure("tdMultiply", (void *)tdMultiply, runMultiply);
+  measure("tdPTransform", (void *)tdPTransform, runPTransform);
+  measure("LocalToScreenspace", (void *)LocalToScreenspace, runScreenspace);
+  measure("CNFGTackRectangle", (void *)CNFGTackRectangle, runRectangle);
+  measure("CNFGDrawText", (void *)CNFGDrawText, runText);
+  measure("tdPerlin2D", (void *)tdPerlin2D, runPerlin);
+  measure("DrawGeoSphere", (void *)DrawGeoSphere, runGeoSphere);
+  Serial.printf("c3place,done\n");
+}
+
+void loop() {
+}
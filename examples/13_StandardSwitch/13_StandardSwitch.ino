@@ -0,0 +1,65 @@
+#include <esp8266channel3lib.h>
+/*
+    ESP8266 Channel 3 standard switch
+
+    Changes between NTSC and PAL every 5 seconds while broadcasting. The
+    framebuffer is allocated once for PAL, the larger of both, and the
+    change happens at the end of a frame without stopping the DMA. A
+    border and the current standard show the framebuffer size; the time
+    from the request to the first line in the new standard is printed on
+    the serial port (115200 baud).
+*/
+
+#define SWITCH_MS 5000
+
+char status[40];
+
+// This callback gets called automatically every frame
+void ICACHE_FLASH_ATTR loadFrame() {
+  video_broadcast_clear_frame();
+  int w = video_broadcast_framebuffer_width() / 2;
+  int h = video_broadcast_framebuffer_height();
+
+  CNFGColor(C3_COL_WHITE);
+  CNFGTackSegment(0, 0, w - 1, 0);
+  CNFGTackSegment(w - 1, 0, w - 1, h - 1);
+  CNFGTackSegment(w - 1, h - 1, 0, h - 1);
+  CNFGTackSegment(0, h - 1, 0, 0);
+
+  CNFGColor(C3_COL_DD_WHITE);
+  CNFGPenX = 8;
+  CNFGPenY = h / 2 - 6;
+  CNFGDrawText(status, 2);
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+
+  video_broadcast_reserve_standards(1);
+  channel3Init(NTSC, &loadFrame);
+  snprintf(status, sizeof(status), "NTSC 220 lines");
+}
+
+void loop() {
+  static uint32_t lastSwitch = 0;
+  static bool reported = true;
+
+  if (!reported && !video_broadcast_standard_pending()) {
+    reported = true;
+    bool pal = video_broadcast_get_standard() == PAL;
+    snprintf(status, sizeof(status), "%s %d lines", pal ? "PAL" : "NTSC", video_broadcast_framebuffer_height());
+    Serial.printf("%s after %u us\n", pal ? "PAL" : "NTSC", video_broadcast_switch_us());
+  }
+
+  if (millis() - lastSwitch < SWITCH_MS) {
+    return;
+  }
+  lastSwitch = millis();
+  channel3VideoType_t next = (video_broadcast_get_standard() == PAL) ? NTSC : PAL;
+  if (channel3SetStandard(next)) {
+    reported = false;
+  } else {
+    Serial.printf("framebuffer too small to switch\n");
+  }
+}
@@ -0,0 +1,85 @@
+#include <esp8266channel3lib.h>
+/* 
+    ESP8266 Channel 3 text benchmark
+
+    Draws a full page of text with and without the glyph cache and
+    prints the throughput in characters per millisecond on the serial
+    port (115200 baud). The video interrupt keeps running while this
+    is measured, so the numbers include its overhead.
+*/
+
+#define BENCH_ROUNDS 20
+
+static const char page[] =
+  "ESP8266 Channel 3 text benchmark\n"
+  "The quick brown fox jumps over\n"
+  "the lazy dog. 0123456789 !?#%&\n"
+  "THE QUICK BROWN FOX JUMPS OVER\n"
+  "THE LAZY DOG. ()[]{}<>+-*/=:;,.\n"
+  "Status: OK    Temp: 23.5C\n"
+  "Uptime: 12:34:56  Frames: 4711\n"
+  "abcdefghijklmnopqrstuvwxyz\n"
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZ\n";
+
+char results[4][40];
+
+// Number of printable characters in the page
+static int pageChars() {
+  int n = 0;
+  for (const char *c = page; *c; c++) {
+    if (*c != '\n') n++;
+  }
+  return n;
+}
+
+static float benchmark(uint8_t cached, int scale, uint8_t color) {
+  CNFGGlyphCacheEnable(cached);
+  CNFGGlyphCacheFlush();
+  CNFGColor(color);
+
+  uint32_t start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_ROUNDS; i++) {
+    CNFGPenX = 2;
+    CNFGPenY = 2;
+    CNFGDrawText(page, scale);
+  }
+  uint32_t cycles = ESP.getCycleCount() - start;
+
+  float ms = cycles / (system_get_cpu_freq() * 1000.0f);
+  return (pageChars() * BENCH_ROUNDS) / ms;
+}
+
+// This callback gets called automatically every frame
+void ICACHE_FLASH_ATTR loadFrame() {
+  video_broadcast_clear_frame();
+  CNFGColor(C3_COL_DD_WHITE);
+  CNFGPenX = 4;
+  for (int i = 0; i < 4; i++) {
+    CNFGPenY = 10 + i * 14;
+    CNFGDrawText(results[i], 2);
+  }
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+  channel3Init(NTSC, NULL);
+  delay(100);
+
+  Serial.println("mode,scale,chars_per_ms");
+  for (int scale = 1; scale <= 2; scale++) {
+    float stroked = benchmark(0, scale, C3_COL_DD_WHITE);
+    float cached = benchmark(1, scale, C3_COL_DD_WHITE);
+    Serial.printf("stroked,%d,%.1f\n", scale, stroked);
+    Serial.printf("cached,%d,%.1f\n", scale, cached);
+    sprintf(results[(scale - 1) * 2], "x%d stroked: %d ch/ms", scale, (int)stroked);
+    sprintf(results[(scale - 1) * 2 + 1], "x%d cached:  %d ch/ms", scale, (int)cached);
+  }
+  CNFGGlyphCacheEnable(1);
+
+  channel3Deinit();
+  channel3Init(NTSC, &loadFrame);
+}
+
+void loop() {
+}
@@ -0,0 +1,140 @@
+#include <esp8266channel3lib.h>
+/* 
+    ESP8266 Channel 3 blit benchmark
+
+    Blits 32x32 sprites from flash in the different formats and prints
+    the throughput in pixels per microsecond on the serial port
+    (115200 baud). The video interrupt keeps running while this is
+    measured, so the numbers include its overhead.
+*/
+
+#define BENCH_BLITS 500
+
+// 4bpp ring, 4 words per row
+static const uint32_t ring4[] PROGMEM = {
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff1000, 0x0001ffff, 0x00000000,
+  0x00000000, 0xeeeefff1, 0x1fffeeee, 0x00000000, 0x10000000, 0xddddeeff, 0xffeedddd, 0x00000001,
+  0xff000000, 0xcccdddee, 0xeedddccc, 0x000000ff, 0xeff00000, 0xbbbcccdd, 0xddcccbbb, 0x00000ffe,
+  0xdeff0000, 0xaaabbbcd, 0xdcbbbaaa, 0x0000ffed, 0xddef1000, 0x999aabbc, 0xcbbaa999, 0x0001fedd,
+  0xcddef100, 0x88899aab, 0xbaa99888, 0x001feddc, 0xbcdeff00, 0x777889aa, 0xaa988777, 0x00ffedcb,
+  0xbbcdef00, 0x6677889a, 0xa9887766, 0x00fedcbb, 0xabcdef10, 0x55667889, 0x98876655, 0x01fedcba,
+  0xabcddef0, 0x44556789, 0x98765544, 0x0feddcba, 0x9abcdef0, 0x33456778, 0x87765433, 0x0fedcba9,
+  0x9abcdef0, 0x23345678, 0x87654332, 0x0fedcba9, 0x9abcdef0, 0x12345678, 0x87654321, 0x0fedcba9,
+  0x9abcdef0, 0x12345678, 0x87654321, 0x0fedcba9, 0x9abcdef0, 0x23345678, 0x87654332, 0x0fedcba9,
+  0x9abcdef0, 0x33456778, 0x87765433, 0x0fedcba9, 0xabcddef0, 0x44556789, 0x98765544, 0x0feddcba,
+  0xabcdef10, 0x55667889, 0x98876655, 0x01fedcba, 0xbbcdef00, 0x6677889a, 0xa9887766, 0x00fedcbb,
+  0xbcdeff00, 0x777889aa, 0xaa988777, 0x00ffedcb, 0xcddef100, 0x88899aab, 0xbaa99888, 0x001feddc,
+  0xddef1000, 0x999aabbc, 0xcbbaa999, 0x0001fedd, 0xdeff0000, 0xaaabbbcd, 0xdcbbbaaa, 0x0000ffed,
+  0xeff00000, 0xbbbcccdd, 0xddcccbbb, 0x00000ffe, 0xff000000, 0xcccdddee, 0xeedddccc, 0x000000ff,
+  0x10000000, 0xddddeeff, 0xffeedddd, 0x00000001, 0x00000000, 0xeeeefff1, 0x1fffeeee, 0x00000000,
+  0x00000000, 0xffff1000, 0x0001ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+// The same ring run length encoded
+static const uint32_t ringRle[] PROGMEM = {
+  0x00000020, 0x00000021, 0x00000023, 0x00000025, 0x00000028, 0x0000002b, 0x0000002e, 0x00000032,
+  0x00000037, 0x0000003c, 0x00000041, 0x00000047, 0x0000004e, 0x00000055, 0x0000005c, 0x00000064,
+  0x0000006c, 0x00000074, 0x0000007c, 0x00000083, 0x0000008a, 0x00000091, 0x00000097, 0x0000009c,
+  0x000000a1, 0x000000a6, 0x000000aa, 0x000000ad, 0x000000b0, 0x000000b3, 0x000000b5, 0x000000b7,
+  0x0000f0f0, 0x017f01a0, 0x000000a0, 0x7e2f0170, 0x0070012f, 0x1e1f0160, 0x011f1e7d, 0x00000060,
+  0x2d1e1f50, 0x1f1e2d5c, 0x00000050, 0x1d0e1f40, 0x1d2c5b2c, 0x00401f0e, 0x1d0e1f30, 0x2b5a2b0c,
+  0x1f0e1d0c, 0x00000030, 0x0e0f0120, 0x1a1b0c1d, 0x0c1b1a59, 0x010f0e1d, 0x00000020, 0x0e0f0110,
+  0x1a0b0c1d, 0x1a195819, 0x0e1d0c0b, 0x0010010f, 0x0d0e1f10, 0x091a0b0c, 0x09185718, 0x0d0c0b1a,
+  0x00101f0e, 0x0d0e0f10, 0x090a1b0c, 0x17361718, 0x1b0a0918, 0x0f0e0d0c, 0x00000010, 0x0e0f0100,
+  0x0a0b0c0d, 0x16071809, 0x18071635, 0x0c0b0a09, 0x010f0e0d, 0x00000000, 0x1d0e0f00, 0x090a0b0c,
+  0x15060708, 0x07061534, 0x0b0a0908, 0x0f0e1d0c, 0x00000000, 0x0d0e0f00, 0x090a0b0c, 0x05061708,
+  0x05043304, 0x09081706, 0x0d0c0b0a, 0x00000f0e, 0x0d0e0f00, 0x090a0b0c, 0x05060708, 0x13121304,
+  0x07060504, 0x0b0a0908, 0x0f0e0d0c, 0x00000000, 0x0d0e0f00, 0x090a0b0c, 0x05060708, 0x11020304,
+  0x05040302, 0x09080706, 0x0d0c0b0a, 0x00000f0e, 0x0d0e0f00, 0x090a0b0c, 0x05060708, 0x11020304,
+  0x05040302, 0x09080706, 0x0d0c0b0a, 0x00000f0e, 0x0d0e0f00, 0x090a0b0c, 0x05060708, 0x13121304,
+  0x07060504, 0x0b0a0908, 0x0f0e0d0c, 0x00000000, 0x0d0e0f00, 0x090a0b0c, 0x05061708, 0x05043304,
+  0x09081706, 0x0d0c0b0a, 0x00000f0e, 0x1d0e0f00, 0x090a0b0c, 0x15060708, 0x07061534, 0x0b0a0908,
+  0x0f0e1d0c, 0x00000000, 0x0e0f0100, 0x0a0b0c0d, 0x16071809, 0x18071635, 0x0c0b0a09, 0x010f0e0d,
+  0x00000000, 0x0d0e0f10, 0x090a1b0c, 0x17361718, 0x1b0a0918, 0x0f0e0d0c, 0x00000010, 0x0d0e1f10,
+  0x091a0b0c, 0x09185718, 0x0d0c0b1a, 0x00101f0e, 0x0e0f0110, 0x1a0b0c1d, 0x1a195819, 0x0e1d0c0b,
+  0x0010010f, 0x0e0f0120, 0x1a1b0c1d, 0x0c1b1a59, 0x010f0e1d, 0x00000020, 0x1d0e1f30, 0x2b5a2b0c,
+  0x1f0e1d0c, 0x00000030, 0x1d0e1f40, 0x1d2c5b2c, 0x00401f0e, 0x2d1e1f50, 0x1f1e2d5c, 0x00000050,
+  0x1e1f0160, 0x011f1e7d, 0x00000060, 0x7e2f0170, 0x0070012f, 0x017f01a0, 0x000000a0, 0x0000f0f0,
+};
+
+// 1bpp checkered disc, 1 word per row
+static const uint32_t checker1[] PROGMEM = {
+  0x00000000, 0x0010f000, 0x00f0f000, 0x00f0f080, 0x030f0f00, 0x070f0f00, 0x0f0f0f00, 0x0f0f0f08,
+  0x30f0f0f0, 0x30f0f0f0, 0x30f0f0f0, 0x70f0f0f0, 0x0f0f0f0e, 0x0f0f0f0e, 0x0f0f0f0e, 0x0f0f0f0e,
+  0x70f0f0f0, 0x70f0f0f0, 0x70f0f0f0, 0x70f0f0f0, 0x0f0f0f0e, 0x0f0f0f0c, 0x0f0f0f0c, 0x0f0f0f0c,
+  0x10f0f0f0, 0x00f0f0f0, 0x00f0f0e0, 0x00f0f0c0, 0x010f0f00, 0x000f0f00, 0x000f0800, 0x00000000,
+};
+
+static const uint8_t ringPalette[16] = {
+  C3_COL_BLACK, C3_COL_WHITE, C3_COL_LIGHT_GRAY, C3_COL_DARK_GRAY,
+  C3_COL_STRIPED_GRAY_1, C3_COL_STRIPED_GRAY_2, C3_COL_WHITE, C3_COL_LIGHT_GRAY,
+  C3_COL_DARK_GRAY, C3_COL_STRIPED_GRAY_1, C3_COL_STRIPED_GRAY_2, C3_COL_WHITE,
+  C3_COL_LIGHT_GRAY, C3_COL_DARK_GRAY, C3_COL_STRIPED_GRAY_1, C3_COL_STRIPED_GRAY_2,
+};
+
+static const c3Bitmap_t ring = { ring4, NULL, 32, 32, 4, C3_BMP_4BPP, C3_BMP_NO_KEY };
+static const c3Bitmap_t ringKeyed = { ring4, ringPalette, 32, 32, 4, C3_BMP_4BPP, 0 };
+static const c3Bitmap_t ringCompressed = { ringRle, ringPalette, 32, 32, 0, C3_BMP_4BPP | C3_BMP_RLE, 0 };
+static const c3Bitmap_t checker = { checker1, NULL, 32, 32, 1, C3_BMP_1BPP, 0 };
+
+char results[7][40];
+
+static float benchmark(const c3Bitmap_t *bmp, uint8_t flags, int xStep) {
+  int width = (flags & C3_BLIT_DD) ? video_broadcast_framebuffer_width() : video_broadcast_framebuffer_width() / 2;
+  int x = 0;
+
+  uint32_t start = ESP.getCycleCount();
+  for (int i = 0; i < BENCH_BLITS; i++) {
+    c3Blit(bmp, x, 40, flags);
+    x += xStep;
+    if (x > width - 32) x = 0;
+  }
+  uint32_t cycles = ESP.getCycleCount() - start;
+
+  float us = cycles / (float)system_get_cpu_freq();
+  return (32 * 32 * BENCH_BLITS) / us;
+}
+
+// This callback gets called automatically every frame
+void ICACHE_FLASH_ATTR loadFrame() {
+  video_broadcast_clear_frame();
+  CNFGColor(C3_COL_DD_WHITE);
+  CNFGPenX = 4;
+  for (int i = 0; i < 7; i++) {
+    CNFGPenY = 10 + i * 14;
+    CNFGDrawText(results[i], 2);
+  }
+  c3Blit(&ringKeyed, 80, 110, 0);
+  c3Blit(&checker, 190, 110, C3_BLIT_DD);
+}
+
+static void report(int n, const char *name, float pxPerUs) {
+  Serial.printf("%s,%.2f\n", name, pxPerUs);
+  sprintf(results[n], "%s: %d.%02d px/us", name, (int)pxPerUs, (int)(pxPerUs * 100) % 100);
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+  channel3Init(NTSC, NULL);
+  delay(100);
+
+  Serial.println("case,pixels_per_us");
+  report(0, "4bpp aligned", benchmark(&ring, 0, 4));
+  report(1, "4bpp unaligned", benchmark(&ring, 0, 3));
+  report(2, "4bpp keyed", benchmark(&ringKeyed, 0, 3));
+  report(3, "4bpp flipped", benchmark(&ringKeyed, C3_BLIT_FLIP_X, 3));
+  report(4, "4bpp RLE", benchmark(&ringCompressed, 0, 3));
+  report(5, "1bpp DD", benchmark(&checker, C3_BLIT_DD, 5));
+  channel3Deinit();
+
+  // The same onto a packed 1bpp framebuffer
+  channel3InitMode(NTSC, C3_FB_MONO, NULL);
+  delay(100);
+  report(6, "1bpp mono", benchmark(&checker, C3_BLIT_DD, 5));
+  channel3Deinit();
+  channel3Init(NTSC, &loadFrame);
+}
+
+void loop() {
+}
@@ -0,0 +1,51 @@
+#include <esp8266channel3lib.h>
+/* 
+    ESP8266 Channel 3 64 color benchmark
+
+    Shows all 64 colors of C3_FB_EXT64 as an 8x8 grid. Before that it
+    measures how many CPU cycles the video interrupt needs for the
+    slowest line, in the standard and in the 64 color mode, and prints
+    it together with the time one line takes to send on the serial
+    port (115200 baud). The interrupt has to stay below that budget,
+    or the DMA runs out of lines and the picture tears.
+*/
+
+#define BENCH_MS 1000
+
+// This callback gets called automatically every frame
+void ICACHE_FLASH_ATTR loadFrame() {
+  int w = video_broadcast_framebuffer_width() / 2 / 8;
+  int h = video_broadcast_framebuffer_height() / 8;
+  for (int i = 0; i < 64; i++) {
+    int x = (i & 7) * w;
+    int y = (i >> 3) * h;
+    for (int row = y; row < y + h - 1; row++) {
+      video_broadcast_tack_span(x, x + w - 2, row, i);
+    }
+  }
+}
+
+static void benchmark(const char *name, channel3FramebufferMode_t mode) {
+  channel3InitMode(NTSC, mode, &loadFrame);
+  delay(100);
+  video_broadcast_line_cycles_max(1);
+  delay(BENCH_MS);
+  uint32_t cycles = video_broadcast_line_cycles_max(0);
+  uint32_t budget = video_broadcast_line_cycles_budget();
+  Serial.printf("%s,%u,%u,%u%%\n", name, cycles, budget, (cycles * 100) / budget);
+  channel3Deinit();
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+
+  Serial.println("mode,line_cycles_max,line_cycles_budget,load");
+  benchmark("standard", C3_FB_STANDARD);
+  benchmark("ext64", C3_FB_EXT64);
+
+  channel3InitMode(NTSC, C3_FB_EXT64, &loadFrame);
+}
+
+void loop() {
+}
@@ -0,0 +1,55 @@
+#include <esp8266channel3lib.h>
+/* 
+    ESP8266 Channel 3 display list demo
+
+    Draws a bouncing box, a rotating line fan and text without a
+    framebuffer: the commands are recorded every frame and rendered
+    line by line right before each line is sent. The RAM for the two
+    display lists and the line ring is a few KB instead of the 25 KB
+    of the double framebuffer.
+
+    The slowest line of the video interrupt and the budget are
+    printed on the serial port (115200 baud) every second.
+*/
+
+int boxX = 10, boxY = 40, dirX = 1, dirY = 1;
+uint8_t angle = 0;
+char info[40] = "";
+
+// This callback gets called automatically every frame
+void ICACHE_FLASH_ATTR loadFrame() {
+  if (!c3DlBegin(C3_COL_BLACK)) return;
+
+  c3DlText("Display list", 4, 4, 3, C3_COL_DD_WHITE);
+  c3DlText(info, 4, 200, 2, C3_COL_DD_WHITE);
+
+  // Line fan around the center
+  for (int i = 0; i < 8; i++) {
+    uint8_t a = angle + i * 32;
+    c3DlLine(58, 110, 58 + tdCOS(a) / 6, 110 + tdSIN(a) / 5, 9 + (i & 3));
+  }
+
+  c3DlRect(boxX, boxY, boxX + 15, boxY + 20, C3_COL_LIGHT_GRAY);
+  boxX += dirX;
+  boxY += dirY;
+  if (boxX <= 0 || boxX >= 100) dirX = -dirX;
+  if (boxY <= 30 || boxY >= 180) dirY = -dirY;
+  angle += 2;
+
+  c3DlPresent();
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+  channel3InitMode(NTSC, C3_FB_STRIP, &loadFrame);
+  c3DlInit();
+}
+
+void loop() {
+  delay(1000);
+  uint32_t cycles = video_broadcast_line_cycles_max(1);
+  uint32_t budget = video_broadcast_line_cycles_budget();
+  Serial.printf("line_cycles_max,%u,budget,%u\n", cycles, budget);
+  sprintf(info, "ISR %u%% of a line", (cycles * 100) / budget);
+}
@@ -0,0 +1,80 @@
+#include <esp8266channel3lib.h>
+#include <LittleFS.h>
+/* 
+    ESP8266 Channel 3 video player
+
+    Plays /clip.c3v from LittleFS in a loop. Make the clip from PNG frames
+    with tools/c3video.py, e.g.
+
+        python3 tools/c3video.py encode frames/ --divisor 2 -o data/clip.c3v
+
+    and upload the data folder with the LittleFS uploader of your IDE.
+
+    Before playing it decodes every frame of the clip once as fast as
+    it can and prints the CPU cycles per frame and the bytes read on the
+    serial port (115200 baud). A frame has to be decoded within one
+    video frame (1/60 s NTSC, 1/50 s PAL), and as both framebuffers are
+    kept up to date every clip frame is decoded twice. While playing the
+    slowest frame of the last second is printed.
+*/
+
+static c3Video_t video;
+static File clipFile;
+static bool playing = false;
+
+// This callback gets called automatically every frame
+void ICACHE_FLASH_ATTR loadFrame() {
+  if (playing) {
+    c3VideoUpdate(&video);
+  }
+}
+
+static void benchmark() {
+  uint32_t budget = ESP.getCpuFreqMHz() * 1000000 / 60;
+  uint32_t total = 0;
+  uint32_t bytes = 0;
+  video.cyclesMax = 0;
+  for (int i = 0; i < video.frames; i++) {
+    if (!c3VideoShow(&video, i)) {
+      Serial.printf("frame %d is broken\n", i);
+      return;
+    }
+    total += video.cycles;
+    bytes += video.bytes;
+  }
+  Serial.println("frames,cycles_avg,cycles_max,budget,load_max,bytes_avg,frames_per_s");
+  Serial.printf("%u,%u,%u,%u,%u%%,%u,%u\n", video.frames, total / video.frames, video.cyclesMax, budget,
+    (video.cyclesMax * 100) / budget, bytes / video.frames,
+    (uint32_t)((uint64_t)ESP.getCpuFreqMHz() * 1000000 * video.frames / total));
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+
+  channel3Init(NTSC, &loadFrame);
+
+  if (!LittleFS.begin()) {
+    Serial.println("LittleFS failed");
+    return;
+  }
+  clipFile = LittleFS.open("/clip.c3v", "r");
+  if (!clipFile || !c3VideoOpenFile(&video, &clipFile)) {
+    Serial.println("/clip.c3v is missing or not made for NTSC C3_FB_STANDARD");
+    return;
+  }
+  benchmark();
+
+  // Start playing from the first frame
+  c3VideoOpenFile(&video, &clipFile);
+  c3VideoSetLoop(&video, 1);
+  playing = true;
+}
+
+void loop() {
+  delay(1000);
+  if (playing) {
+    Serial.printf("slowest frame %u cycles\n", video.cyclesMax);
+    video.cyclesMax = 0;
+  }
+}
@@ -0,0 +1,43 @@
+#include <ESP8266WiFi.h>
+#include <esp8266channel3lib.h>
+/* 
+    ESP8266 Channel 3 network frames
+
+    Opens the access point ESP_Channel3 (password ESP_Channel3) and shows
+    the frames a server sends to port 3333 over UDP or TCP. Connect and run
+
+        python3 tools/c3netsend.py send 192.168.4.1 --demo --fps 60
+
+    or send your own PNG frames. The frames go straight into the back
+    buffer and are shown once complete, nothing is drawn on the device.
+    Statistics are printed on the serial port (115200 baud).
+*/
+
+#define PORT 3333
+
+// This callback gets called automatically every frame, the server draws everything
+void ICACHE_FLASH_ATTR loadFrame() {
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+
+  WiFi.softAP("ESP_Channel3", "ESP_Channel3");
+  Serial.printf("Send frames to %s:%d\n", WiFi.softAPIP().toString().c_str(), PORT);
+
+  channel3Init(NTSC /* or PAL */, &loadFrame);
+  c3NetBegin(PORT);
+}
+
+void loop() {
+  static uint32_t lastPrint = 0;
+  c3NetPoll();
+
+  if (millis() - lastPrint > 1000) {
+    lastPrint = millis();
+    const c3NetStats_t *stats = c3NetGetStats();
+    Serial.printf("presented %u, dropped %u, packets %u, bad %u, late %u\n", stats->presented, stats->dropped,
+      stats->packets, stats->badPackets, stats->latePackets);
+  }
+}
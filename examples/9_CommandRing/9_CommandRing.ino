@@ -0,0 +1,62 @@
+#include <esp8266channel3lib.h>
+/* 
+    ESP8266 Channel 3 command ring
+
+    Draws from loop() instead of the frame callback. The commands go into
+    a ring that the library drains right before every frame, into the
+    frame that is sent next, so drawing never races the picture on screen.
+    Every command is drawn onto both framebuffers, so the picture is only
+    changed where loop() changes it: the box is moved by drawing over its
+    old place in black. The number of steps drawn is counted in the frame
+    path as well and printed on the serial port (115200 baud).
+*/
+
+#define BOX 12
+
+// This callback gets called automatically every frame. It must not clear
+// the frame, that would wipe what loop() drew.
+void ICACHE_FLASH_ATTR loadFrame() {
+}
+
+// Steps drawn, only changed in the frame path
+volatile uint32_t steps = 0;
+
+// Runs in the frame path, between two frames
+void countStep(void *arg) {
+  steps++;
+}
+
+void setup() {
+  system_update_cpu_freq(SYS_CPU_160MHZ);
+  Serial.begin(115200);
+
+  channel3Init(NTSC /* or PAL */, &loadFrame);
+  c3CmdClear();
+  c3CmdText(10, 10, "Drawn from loop()", 2, C3_COL_WHITE);
+  c3CmdRect(0, 40, 115, 41, C3_COL_LIGHT_GRAY);
+}
+
+void loop() {
+  static int lastFrame = -1;
+  static int x = 0, y = 50, dx = 1, dy = 1;
+  static uint32_t lastPrint = 0;
+
+  if (millis() - lastPrint > 1000) {
+    lastPrint = millis();
+    Serial.printf("%u steps drawn\n", steps);
+  }
+
+  // One step per frame, and only if all three commands fit
+  if (video_broadcast_get_frame_number() == lastFrame || c3CmdSpace() < 3) {
+    return;
+  }
+  lastFrame = video_broadcast_get_frame_number();
+
+  c3CmdRect(x, y, x + BOX - 1, y + BOX - 1, C3_COL_BLACK);
+  x += dx;
+  y += dy;
+  if (x <= 0 || x + BOX >= 116) dx = -dx;
+  if (y <= 42 || y + BOX >= 220) dy = -dy;
+  c3CmdRect(x, y, x + BOX - 1, y + BOX - 1, C3_COL_RED);
+  c3CmdCall(countStep, NULL);
+}
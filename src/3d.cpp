@@ -1,4 +1,6 @@
 #include "3d.h"
+#include "mesh.h"
+#include "glyph_cache.h"
 #include <stdio.h>
 
 #define m00 0
@@ -27,39 +29,85 @@ uint16_t LTW = video_broadcast_framebuffer_width();
 uint8_t CNFGDialogColor; //background for boxes
 
 
-uint8_t sintable[128] = { 0, 6, 12, 18, 25, 31, 37, 43, 49, 55, 62, 68, 74, 80, 86, 91, 97, 103, 109, 114, 120, 125, 131, 136, 141, 147, 152, 157, 162, 166, 171, 176, 180, 185, 189, 193, 197, 201, 205, 208, 212, 215, 219, 222, 225, 228, 230, 233, 236, 238, 240, 242, 244, 246, 247, 249, 250, 251, 252, 253, 254, 254, 255, 255, 255, 255, 255, 254, 254, 253, 252, 251, 250, 249, 247, 246, 244, 242, 240, 238, 236, 233, 230, 228, 225, 222, 219, 215, 212, 208, 205, 201, 197, 193, 189, 185, 180, 176, 171, 166, 162, 157, 152, 147, 141, 136, 131, 125, 120, 114, 109, 103, 97, 91, 86, 80, 74, 68, 62, 55, 49, 43, 37, 31, 25, 18, 12, 6, };
+//Sine of x (radians, 0..pi/2) for building tables at compile time
+static constexpr double tdConstSin( double x )
+{
+	double term = x;
+	double sum = x;
+	for( int n = 1; n < 12; n++ )
+	{
+		term *= -x * x / ((2*n) * (2*n+1));
+		sum += term;
+	}
+	return sum;
+}
 
-int16_t tdSIN( uint8_t iv )
+//Quarter wave, sin(0)..sin(90 degrees) as 8.8 fixed point.  The extra entry lets lookups interpolate up to 90 degrees.
+struct tdSinQuarterTable
 {
-	if( iv > 127 )
+	int16_t v[TD_SIN_QUARTER+1];
+	constexpr tdSinQuarterTable() : v()
 	{
-		return -sintable[iv-128];
+		for( int i = 0; i <= TD_SIN_QUARTER; i++ )
+			v[i] = (int16_t)(tdConstSin( i * 1.57079632679489661923 / TD_SIN_QUARTER ) * 256.0 + 0.5);
 	}
-	else
+};
+static constexpr tdSinQuarterTable tdSinQuarter;
+
+void C3_VERTEX_ATTR tdSinCos( uint16_t angle, int16_t * s, int16_t * c )
+{
+	uint16_t index = angle >> (16 - TD_SIN_BITS);
+	uint16_t i = index & (TD_SIN_QUARTER-1);
+	int16_t a = tdSinQuarter.v[i];
+	int16_t b = tdSinQuarter.v[TD_SIN_QUARTER-i];
+#if TD_SIN_LERP
+	uint16_t frac = angle & ((1<<(16 - TD_SIN_BITS))-1);
+	a += ((tdSinQuarter.v[i+1] - a) * frac + (1<<(15 - TD_SIN_BITS))) >> (16 - TD_SIN_BITS);
+	b += ((tdSinQuarter.v[TD_SIN_QUARTER-i-1] - b) * frac + (1<<(15 - TD_SIN_BITS))) >> (16 - TD_SIN_BITS);
+#endif
+
+	//a and b are sin and cos within the quadrant
+	switch( index >> (TD_SIN_BITS-2) )
 	{
-		return sintable[iv];
+	case 0: *s = a; *c = b; break;
+	case 1: *s = b; *c = -a; break;
+	case 2: *s = -a; *c = -b; break;
+	default: *s = -b; *c = a; break;
 	}
 }
 
+int16_t tdSIN( uint8_t iv )
+{
+	int16_t s, c;
+	tdSinCos( iv << 8, &s, &c );
+	return s;
+}
+
 int16_t tdCOS( uint8_t iv )
 {
-	return tdSIN( iv + 64 );
+	int16_t s, c;
+	tdSinCos( iv << 8, &s, &c );
+	return c;
 }
 
 
 void ICACHE_FLASH_ATTR MakeXRotationMatrix( uint8_t angle, int16_t * f )
 {
+	int16_t s, c;
+	tdSinCos( angle << 8, &s, &c );
 	f[0] = 256;  f[1] = 0;  f[2] = 0;  f[3] = 0;
-	f[4] = 0;  f[5] = tdCOS( angle );  f[6] = -tdSIN( angle );  f[7] = 0;
-	f[8] = 0;  f[9] = tdSIN( angle );  f[10] = tdCOS( angle );  f[11] = 0;
+	f[4] = 0;  f[5] = c;  f[6] = -s;  f[7] = 0;
+	f[8] = 0;  f[9] = s;  f[10] = c;  f[11] = 0;
 	f[12] = 0;  f[13] = 0;  f[14] = 0;  f[15] = 256;
 }
 
 void ICACHE_FLASH_ATTR MakeYRotationMatrix( uint8_t angle, int16_t * f )
 {
-	f[0] = tdCOS( angle );  f[1] = 0;  f[2] = tdSIN( angle );  f[3] = 0;
+	int16_t s, c;
+	tdSinCos( angle << 8, &s, &c );
+	f[0] = c;  f[1] = 0;  f[2] = s;  f[3] = 0;
 	f[4] = 0;  f[5] = 256;  f[6] = 0;  f[7] = 0;
-	f[8] = -tdSIN( angle );  f[9] = 0;  f[10] = tdCOS( angle );  f[11] = 0;
+	f[8] = -s;  f[9] = 0;  f[10] = c;  f[11] = 0;
 	f[12] = 0;  f[13] = 0;  f[14] = 0;  f[15] = 256;
 }
 
@@ -121,16 +169,19 @@ void ICACHE_FLASH_ATTR tdScale( int16_t * f, int16_t x, int16_t y, int16_t z )
 }
 
 void ICACHE_FLASH_ATTR tdRotateEA( int16_t * f, int16_t x, int16_t y, int16_t z )
+{
+	tdRotateEAFine( f, x << 8, y << 8, z << 8 );
+}
+
+void ICACHE_FLASH_ATTR tdRotateEAFine( int16_t * f, uint16_t x, uint16_t y, uint16_t z )
 {
 	int16_t ftmp[16];
+	int16_t cx, sx, cy, sy, cz, sz;
 
 	//x,y,z must be negated for some reason
-	int16_t cx = tdCOS(x);
-	int16_t sx = tdSIN(x);
-	int16_t cy = tdCOS(y);
-	int16_t sy = tdSIN(y);
-	int16_t cz = tdCOS(z);
-	int16_t sz = tdSIN(z);
+	tdSinCos( x, &sx, &cx );
+	tdSinCos( y, &sy, &cy );
+	tdSinCos( z, &sz, &cz );
 
 	//Row major
 	//manually transposed
@@ -152,14 +203,14 @@ void ICACHE_FLASH_ATTR tdRotateEA( int16_t * f, int16_t x, int16_t y, int16_t z
 	ftmp[m03] = 0;
 	ftmp[m13] = 0;
 	ftmp[m23] = 0;
-	ftmp[m33] = 1;
+	ftmp[m33] = 256;
 
 	tdMultiply( f, ftmp, f );
 }
 
 
 
-void ICACHE_FLASH_ATTR tdMultiply( int16_t * fin1, int16_t * fin2, int16_t * fout )
+void C3_DRAW_ATTR tdMultiply( int16_t * fin1, int16_t * fin2, int16_t * fout )
 {
 	int16_t fotmp[16];
 
@@ -186,7 +237,7 @@ void ICACHE_FLASH_ATTR tdMultiply( int16_t * fin1, int16_t * fin2, int16_t * fou
 	ets_memcpy( fout, fotmp, sizeof( fotmp ) );
 }
 
-void ICACHE_FLASH_ATTR tdPTransform( int16_t * pin, int16_t * f, int16_t * pout )
+void C3_VERTEX_ATTR tdPTransform( int16_t * pin, int16_t * f, int16_t * pout )
 {
 	int16_t ptmp[2];
 	ptmp[0] = ((pin[0] * f[m00] + pin[1] * f[m01] + pin[2] * f[m02])>>8) + f[m03];
@@ -196,7 +247,7 @@ void ICACHE_FLASH_ATTR tdPTransform( int16_t * pin, int16_t * f, int16_t * pout
 	pout[1] = ptmp[1];
 }
 
-void td4Transform( int16_t * pin, int16_t * f, int16_t * pout )
+void C3_VERTEX_ATTR td4Transform( int16_t * pin, int16_t * f, int16_t * pout )
 {
 	int16_t ptmp[3];
 	ptmp[0] = (pin[0] * f[m00] + pin[1] * f[m01] + pin[2] * f[m02] + pin[3] * f[m03])>>8;
@@ -209,28 +260,111 @@ void td4Transform( int16_t * pin, int16_t * f, int16_t * pout )
 }
 
 
-void ICACHE_FLASH_ATTR LocalToScreenspace( int16_t * coords_3v, int16_t * o1, int16_t * o2 )
+//Projects a clip-space point (as produced by td4Transform with ProjectionMatrix) onto the screen.
+//The point must be in front of the near plane (clip_4v[3] <= -TD_NEAR_CLIP).
+static void C3_VERTEX_ATTR ClipToScreenspace( int16_t * clip_4v, int * o1, int * o2 )
 {
-	int16_t tmppt[4] = { coords_3v[0], coords_3v[1], coords_3v[2], 256 };
-	td4Transform( tmppt, ModelviewMatrix, tmppt );
-	td4Transform( tmppt, ProjectionMatrix, tmppt );
-	if( tmppt[3] >= 0 ) { *o1 = -1; *o2 = -1; return; }
-
 	if( CNFGLastColor > 15 )
 	{
 		//Half-height mode
-		*o1 = (256 * tmppt[0] / tmppt[3])/8+(video_broadcast_framebuffer_width()/2);
-		*o2 = (256 * tmppt[1] / tmppt[3])/8+(video_broadcast_framebuffer_height()/2);
+		*o1 = (256 * clip_4v[0] / clip_4v[3])/8+(video_broadcast_framebuffer_width()/2);
+		*o2 = (256 * clip_4v[1] / clip_4v[3])/8+(video_broadcast_framebuffer_height()/2);
 	}
 	else
 	{
-		*o1 = ((256 * tmppt[0] / tmppt[3])/8+(video_broadcast_framebuffer_width()/2))/2;
-		*o2 = ((256 * tmppt[1] / tmppt[3])/8+(video_broadcast_framebuffer_height()/2));
+		*o1 = ((256 * clip_4v[0] / clip_4v[3])/8+(video_broadcast_framebuffer_width()/2))/2;
+		*o2 = ((256 * clip_4v[1] / clip_4v[3])/8+(video_broadcast_framebuffer_height()/2));
 	}
 }
 
+void C3_VERTEX_ATTR LocalToClipspace( int16_t * coords_3v, int16_t * clip_4v )
+{
+	clip_4v[0] = coords_3v[0];
+	clip_4v[1] = coords_3v[1];
+	clip_4v[2] = coords_3v[2];
+	clip_4v[3] = 256;
+	td4Transform( clip_4v, ModelviewMatrix, clip_4v );
+	td4Transform( clip_4v, ProjectionMatrix, clip_4v );
+}
+
+void C3_VERTEX_ATTR LocalToScreenspace( int16_t * coords_3v, int16_t * o1, int16_t * o2 )
+{
+	int16_t tmppt[4];
+	int sx, sy;
+	LocalToClipspace( coords_3v, tmppt );
+	if( tmppt[3] > -TD_NEAR_CLIP ) { *o1 = -1; *o2 = -1; return; }
+	ClipToScreenspace( tmppt, &sx, &sy );
+	*o1 = sx;
+	*o2 = sy;
+}
+
+static int64_t ICACHE_FLASH_ATTR tdISqrt( uint64_t v )
+{
+	uint64_t res = 0;
+	uint64_t bit = (uint64_t)1 << 62;
+	while( bit > v ) bit >>= 2;
+	while( bit )
+	{
+		if( v >= res + bit )
+		{
+			v -= res + bit;
+			res = (res >> 1) + bit;
+		}
+		else
+		{
+			res >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (int64_t)res;
+}
 
-void CNFGTackPixelG( int x, int y )
+int ICACHE_FLASH_ATTR tdSphereInFrustum( int16_t * center, int16_t radius )
+{
+	int16_t eye[4] = { center[0], center[1], center[2], 256 };
+	int16_t * P = ProjectionMatrix;
+	int16_t * M = ModelviewMatrix;
+	//Widened by a few pixels, ClipToScreenspace rounds towards the center of the screen.
+	int64_t W = video_broadcast_framebuffer_width() + 4;
+	int64_t H = video_broadcast_framebuffer_height() + 4;
+	int64_t planes[5][4];
+	int64_t maxcol = 0;
+	int i;
+
+	td4Transform( eye, ModelviewMatrix, eye );
+
+	//Scale the radius along with the modelview, use the longest basis vector.
+	for( i = 0; i < 3; i++ )
+	{
+		int64_t len = (int64_t)M[m00+i]*M[m00+i] + (int64_t)M[m10+i]*M[m10+i] + (int64_t)M[m20+i]*M[m20+i];
+		if( len > maxcol ) maxcol = len;
+	}
+	int64_t r = ((int64_t)radius * tdISqrt( maxcol ))>>8;
+
+	//Planes are "inside when <= 0" in eye space.  They are derived from the rows of the projection
+	//and the screen mapping in ClipToScreenspace: |x| <= -w*W/64, |y| <= -w*H/64, w <= -TD_NEAR_CLIP.
+	for( i = 0; i < 4; i++ )
+	{
+		planes[0][i] =  64*P[m00+i] + W*P[m30+i];
+		planes[1][i] = -64*P[m00+i] + W*P[m30+i];
+		planes[2][i] =  64*P[m10+i] + H*P[m30+i];
+		planes[3][i] = -64*P[m10+i] + H*P[m30+i];
+		planes[4][i] = P[m30+i];
+	}
+	planes[4][3] += TD_NEAR_CLIP;
+
+	for( i = 0; i < 5; i++ )
+	{
+		int64_t * p = planes[i];
+		int64_t dist = p[0]*eye[0] + p[1]*eye[1] + p[2]*eye[2] + p[3]*eye[3];
+		int64_t nlen = tdISqrt( p[0]*p[0] + p[1]*p[1] + p[2]*p[2] );
+		if( dist > r * nlen ) return 0;
+	}
+	return 1;
+}
+
+
+void C3_PIXEL_ATTR CNFGTackPixelG( int x, int y )
 {
 	video_broadcast_tack_pixel(x,y, CNFGLastColor);
 }
@@ -246,13 +380,13 @@ void CNFGColor( uint8_t col )
 	CNFGTackPixel = CNFGTackPixelG;
 }
 
-int LABS( int x )
+int C3_PIXEL_ATTR LABS( int x )
 {
 	return (x<0)?-x:x;
 }
 
 //from https://en.wikipedia.org/wiki/Bresenham's_line_algorithm
-void CNFGTackSegment( int x0, int y0, int x1, int y1 )
+void C3_PIXEL_ATTR CNFGTackSegment( int x0, int y0, int x1, int y1 )
 {
 	int deltax = x1 - x0;
 	int deltay = y1 - y0;
@@ -261,11 +395,12 @@ void CNFGTackSegment( int x0, int y0, int x1, int y1 )
 	//int sy = LABS(deltay);
 	int ysg = (y0>y1)?-1:1;
 	int y = y0;
+	int height = video_broadcast_framebuffer_height();
 
 	if( x0 < 0 || x0 >= LTW ) return;
-	if( y0 < 0 || y0 >= video_broadcast_framebuffer_height() ) return;
+	if( y0 < 0 || y0 >= height ) return;
 	if( x1 < 0 || x1 >= LTW ) return;
-	if( y1 < 0 || y1 >= video_broadcast_framebuffer_height() ) return;
+	if( y1 < 0 || y1 >= height ) return;
 
 	if( CNFGLastColor )
 	{
@@ -289,7 +424,7 @@ void CNFGTackSegment( int x0, int y0, int x1, int y1 )
 		{
 			CNFGTackPixel(x,y);
 			error = error + deltaerr;
-			while( error >= 128 && y >= 0 && y < video_broadcast_framebuffer_height())
+			while( error >= 128 && y >= 0 && y < height)
 			{
 				y = y + ysg;
 				CNFGTackPixel(x, y);
@@ -321,7 +456,7 @@ void CNFGTackSegment( int x0, int y0, int x1, int y1 )
 		{
 			CNFGTackPixel(x,y);
 			error = error + deltaerr;
-			while( error >= 128 && y >= 0 && y < video_broadcast_framebuffer_height())
+			while( error >= 128 && y >= 0 && y < height)
 			{
 				y = y + ysg;
 				CNFGTackPixel(x, y);
@@ -333,57 +468,209 @@ void CNFGTackSegment( int x0, int y0, int x1, int y1 )
 	}
 }
 
-int16_t verts[] = { 
-           0, -256,    0,   
-         185, -114,  134,        -70, -114,  217,       -228, -114,    0,        -70, -114, -217,   
-         185, -114, -134,         70,  114,  217,       -185,  114,  134,       -185,  114, -134,   
-          70,  114, -217,        228,  114,    0,          0,  256,    0,        108, -217,   79,   
-         -41, -217,  127,         67, -134,  207,        108, -217,  -79,        217, -134,    0,   
-        -134, -217,    0,       -176, -134,  127,        -41, -217, -127,       -176, -134, -127,   
-          67, -134, -207,        243,    0,  -79,        243,    0,   79,        150,    0,  207,   
-           0,    0,  256,       -150,    0,  207,       -243,    0,   79,       -243,    0,  -79,   
-        -150,    0, -207,          0,    0, -256,        150,    0, -207,        176,  134,  127,   
-         -67,  134,  207,       -217,  134,    0,        -67,  134, -207,        176,  134, -127,   
-         134,  217,    0,         41,  217,  127,       -108,  217,   79,       -108,  217,  -79,   
-          41,  217, -127};
-uint16_t indices[] = {
-          42,  36,     36,   3,      3,  42,     42,  39,     39,  36,      6,  39,     42,   6,     39,   0,   
-           0,  36,     48,   3,     36,  48,     36,  45,     45,  48,     15,  48,     45,  15,      0,  45,   
-          54,  39,      6,  54,     54,  51,     51,  39,      9,  51,     54,   9,     51,   0,     60,  51,   
-           9,  60,     60,  57,     57,  51,     12,  57,     60,  12,     57,   0,     63,  57,     12,  63,   
-          63,  45,     45,  57,     63,  15,     69,   3,     48,  69,     48,  66,     66,  69,     30,  69,   
-          66,  30,     15,  66,     75,   6,     42,  75,     42,  72,     72,  75,     18,  75,     72,  18,   
-           3,  72,     81,   9,     54,  81,     54,  78,     78,  81,     21,  81,     78,  21,      6,  78,   
-          87,  12,     60,  87,     60,  84,     84,  87,     24,  87,     84,  24,      9,  84,     93,  15,   
-          63,  93,     63,  90,     90,  93,     27,  93,     90,  27,     12,  90,     96,  69,     30,  96,   
-          96,  72,     72,  69,     96,  18,     99,  75,     18,  99,     99,  78,     78,  75,     99,  21,   
-         102,  81,     21, 102,    102,  84,     84,  81,    102,  24,    105,  87,     24, 105,    105,  90,   
-          90,  87,    105,  27,    108,  93,     27, 108,    108,  66,     66,  93,    108,  30,    114,  18,   
-          96, 114,     96, 111,    111, 114,     33, 114,    111,  33,     30, 111,    117,  21,     99, 117,   
-          99, 114,    114, 117,     33, 117,    120,  24,    102, 120,    102, 117,    117, 120,     33, 120,   
-         123,  27,    105, 123,    105, 120,    120, 123,     33, 123,    108, 111,    108, 123,    123, 111,   
-        };
-
-void ICACHE_FLASH_ATTR Draw3DSegment( int16_t * c1, int16_t * c2 )
-{
-	int16_t sx0, sy0, sx1, sy1;
-	LocalToScreenspace( c1, &sx0, &sy0 );
-	LocalToScreenspace( c2, &sx1, &sy1 );
+//Cohen-Sutherland outcode against the current drawable area.
+static int C3_DRAW_ATTR CNFGOutcode( int x, int y )
+{
+	int code = 0;
+	if( x < 0 ) code |= 1;
+	else if( x >= LTW ) code |= 2;
+	if( y < 0 ) code |= 4;
+	else if( y >= video_broadcast_framebuffer_height() ) code |= 8;
+	return code;
+}
+
+int C3_DRAW_ATTR CNFGClipSegment( int * x0, int * y0, int * x1, int * y1 )
+{
+	int xmax = LTW - 1;
+	int ymax = video_broadcast_framebuffer_height() - 1;
+	int c0 = CNFGOutcode( *x0, *y0 );
+	int c1 = CNFGOutcode( *x1, *y1 );
+
+	while( c0 | c1 )
+	{
+		if( c0 & c1 ) return 0;
+
+		int c = c0 ? c0 : c1;
+		int64_t dx = *x1 - *x0;
+		int64_t dy = *y1 - *y0;
+		int x, y;
+		if( c & 8 )      { y = ymax; x = *x0 + (int)(dx * (ymax - *y0) / dy); }
+		else if( c & 4 ) { y = 0;    x = *x0 + (int)(dx * (0 - *y0) / dy); }
+		else if( c & 2 ) { x = xmax; y = *y0 + (int)(dy * (xmax - *x0) / dx); }
+		else             { x = 0;    y = *y0 + (int)(dy * (0 - *x0) / dx); }
+
+		if( c == c0 ) { *x0 = x; *y0 = y; c0 = CNFGOutcode( x, y ); }
+		else          { *x1 = x; *y1 = y; c1 = CNFGOutcode( x, y ); }
+	}
+	return 1;
+}
+
+void C3_DRAW_ATTR Draw3DSegment( int16_t * c1, int16_t * c2 )
+{
+	int16_t p1[4], p2[4];
+	int sx0, sy0, sx1, sy1;
+	LocalToClipspace( c1, p1 );
+	LocalToClipspace( c2, p2 );
+
+	//Homogeneous clip against the near plane, w <= -TD_NEAR_CLIP is in front of the camera.
+	int d1 = -TD_NEAR_CLIP - p1[3];
+	int d2 = -TD_NEAR_CLIP - p2[3];
+	if( d1 < 0 && d2 < 0 ) return;
+	if( d1 < 0 || d2 < 0 )
+	{
+		int16_t * out = (d1 < 0)?p1:p2;
+		int16_t * in = (d1 < 0)?p2:p1;
+		int dout = (d1 < 0)?d1:d2;
+		int din = (d1 < 0)?d2:d1;
+		int i;
+		for( i = 0; i < 3; i++ )
+			out[i] = in[i] + (out[i] - in[i]) * din / (din - dout);
+		out[3] = -TD_NEAR_CLIP;
+	}
+
+	ClipToScreenspace( p1, &sx0, &sy0 );
+	ClipToScreenspace( p2, &sx1, &sy1 );
+	if( !CNFGClipSegment( &sx0, &sy0, &sx1, &sy1 ) ) return;
 	CNFGTackSegment( sx0, sy0, sx1, sy1 );
 }
 
-void ICACHE_FLASH_ATTR DrawGeoSphere()
+//Scanline triangle filler, 16.16 fixed point edges.  Spans are half-open, so triangles
+//sharing an edge do not overlap.
+void C3_PIXEL_ATTR CNFGTackTriangle( int x0, int y0, int x1, int y1, int x2, int y2 )
 {
-	int i;
-	int nrv = sizeof(indices)/sizeof(uint16_t);
-	for( i = 0; i < nrv; i+=2 )
+	int t;
+	//Sort by y
+	if( y1 < y0 ) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+	if( y2 < y0 ) { t = x0; x0 = x2; x2 = t; t = y0; y0 = y2; y2 = t; }
+	if( y2 < y1 ) { t = x1; x1 = x2; x2 = t; t = y1; y1 = y2; y2 = t; }
+	if( y0 == y2 ) return;
+
+	int ymin = (y0 < 0)?0:y0;
+	int height = video_broadcast_framebuffer_height();
+	int ymax = (y2 > height)?height:y2;
+	int64_t xl = ((int64_t)x0<<16) + (1<<15);
+	int64_t xs = xl;
+	int64_t dl = (((int64_t)(x2-x0))<<16) / (y2-y0);
+	int64_t ds = (y1 != y0)?((((int64_t)(x1-x0))<<16) / (y1-y0)):0;
+	int y;
+
+	//Long edge goes y0->y2, short edges y0->y1 then y1->y2
+	if( ymin > y0 )
+	{
+		xl += dl * (ymin - y0);
+		if( ymin < y1 ) xs += ds * (ymin - y0);
+	}
+	for( y = ymin; y < ymax; y++ )
 	{
-		int16_t * c1 = &verts[indices[i]];
-		int16_t * c2 = &verts[indices[i+1]];
-		Draw3DSegment( c1, c2 );
+		if( y == y1 || (y == ymin && y > y1) )
+		{
+			ds = (((int64_t)(x2-x1))<<16) / (y2-y1);
+			xs = ((int64_t)x1<<16) + (1<<15) + ds * (y - y1);
+		}
+		int a = (int)(xl>>16);
+		int b = (int)(xs>>16);
+		if( a > b ) { t = a; a = b; b = t; }
+		if( b > a ) video_broadcast_tack_span( a, b-1, y, CNFGLastColor );
+		xl += dl;
+		xs += ds;
 	}
 }
 
+//Gray ramp from black to white, the striped grays fill in between the solid levels.
+static const uint8_t CNFGGrayRamp[] = { C3_COL_BLACK, C3_COL_DARK_GRAY, C3_COL_STRIPED_GRAY_1, C3_COL_STRIPED_GRAY_2, C3_COL_LIGHT_GRAY, C3_COL_WHITE };
+
+uint8_t CNFGShadeColor( int16_t intensity )
+{
+	if( intensity <= 0 ) return CNFGGrayRamp[0];
+	if( intensity >= 256 ) return CNFGGrayRamp[sizeof(CNFGGrayRamp)-1];
+	return CNFGGrayRamp[(intensity * sizeof(CNFGGrayRamp))>>8];
+}
+
+int16_t ICACHE_FLASH_ATTR tdFaceLight( int16_t * c1, int16_t * c2, int16_t * c3 )
+{
+	int16_t e1[4] = { c1[0], c1[1], c1[2], 256 };
+	int16_t e2[4] = { c2[0], c2[1], c2[2], 256 };
+	int16_t e3[4] = { c3[0], c3[1], c3[2], 256 };
+	td4Transform( e1, ModelviewMatrix, e1 );
+	td4Transform( e2, ModelviewMatrix, e2 );
+	td4Transform( e3, ModelviewMatrix, e3 );
+	int64_t ax = e2[0]-e1[0], ay = e2[1]-e1[1], az = e2[2]-e1[2];
+	int64_t bx = e3[0]-e1[0], by = e3[1]-e1[1], bz = e3[2]-e1[2];
+	int64_t nx = ay*bz - az*by;
+	int64_t ny = az*bx - ax*bz;
+	int64_t nz = ax*by - ay*bx;
+	int64_t len = tdISqrt( nx*nx + ny*ny + nz*nz );
+	if( len == 0 ) return 0;
+	nz = (nz<0)?-nz:nz;
+	return (int16_t)((nz*256)/len);
+}
+
+//Clips the n vertices of in against the near plane and writes the clipped polygon to out.  Returns its vertex count.
+static int ICACHE_FLASH_ATTR tdClipPolyNear( int16_t (*in)[4], int n, int16_t (*out)[4] )
+{
+	int i, k;
+	int no = 0;
+	for( i = 0; i < n; i++ )
+	{
+		int16_t * a = in[i];
+		int16_t * b = in[(i+1)%n];
+		int da = -TD_NEAR_CLIP - a[3];
+		int db = -TD_NEAR_CLIP - b[3];
+		if( da >= 0 )
+		{
+			for( k = 0; k < 4; k++ ) out[no][k] = a[k];
+			no++;
+		}
+		if( (da < 0) != (db < 0) )
+		{
+			for( k = 0; k < 3; k++ )
+				out[no][k] = a[k] + (b[k] - a[k]) * da / (da - db);
+			out[no][3] = -TD_NEAR_CLIP;
+			no++;
+		}
+	}
+	return no;
+}
+
+int ICACHE_FLASH_ATTR tdProjectTriangle( int16_t * c1, int16_t * c2, int16_t * c3, int * sx, int * sy, int16_t * w )
+{
+	int16_t clip[3][4];
+	int16_t poly[4][4];
+	int i, n;
+
+	LocalToClipspace( c1, clip[0] );
+	LocalToClipspace( c2, clip[1] );
+	LocalToClipspace( c3, clip[2] );
+	n = tdClipPolyNear( clip, 3, poly );
+	if( n < 3 ) return 0;
+
+	for( i = 0; i < n; i++ )
+	{
+		ClipToScreenspace( poly[i], &sx[i], &sy[i] );
+		if( w ) w[i] = poly[i][3];
+	}
+
+	//Back-face culling, front faces run clockwise on screen.
+	int64_t area = (int64_t)(sx[1]-sx[0])*(sy[2]-sy[0]) - (int64_t)(sx[2]-sx[0])*(sy[1]-sy[0]);
+	if( area <= 0 ) return 0;
+	return n;
+}
+
+void ICACHE_FLASH_ATTR Draw3DTriangle( int16_t * c1, int16_t * c2, int16_t * c3 )
+{
+	int sx[4], sy[4];
+	int i;
+	int n = tdProjectTriangle( c1, c2, c3, sx, sy, 0 );
+
+	for( i = 1; i < n-1; i++ )
+		CNFGTackTriangle( sx[0], sy[0], sx[i], sy[i], sx[i+1], sy[i+1] );
+}
+
+void ICACHE_FLASH_ATTR DrawGeoSphere()
+{
+	tdDrawMeshWire( &tdGeoSphereMesh );
+}
+
 
 
 const unsigned short FontCharMap[128] = {
@@ -461,7 +748,7 @@ const unsigned char FontCharData[949] = {
 
 int CNFGPenX, CNFGPenY;
 
-void ICACHE_FLASH_ATTR CNFGDrawText( const char * text, int scale )
+void C3_DRAW_ATTR CNFGDrawText( const char * text, int scale )
 {
 
 	const unsigned char * lmap;
@@ -492,6 +779,12 @@ void ICACHE_FLASH_ATTR CNFGDrawText( const char * text, int scale )
 				break;
 			}
 
+			if( CNFGGlyphCacheEnabled() && CNFGBlitGlyph( c, iox, ioy, scale ) )
+			{
+				iox += 3 * scale;
+				break;
+			}
+
 			lmap = &FontCharData[index];
 			do
 			{
@@ -523,7 +816,7 @@ void ICACHE_FLASH_ATTR CNFGDrawBox(  int x1, int y1, int x2, int y2 )
 	CNFGTackSegment( x1, y2, x1, y1 );
 }
 
-void ICACHE_FLASH_ATTR CNFGTackRectangle( short x1, short y1, short x2, short y2 )
+void C3_DRAW_ATTR CNFGTackRectangle( short x1, short y1, short x2, short y2 )
 {
 	short ly = 0;
 	short my = 0;
@@ -546,54 +839,150 @@ void ICACHE_FLASH_ATTR CNFGTackRectangle( short x1, short y1, short x2, short y2
 
 
 
-int16_t ICACHE_FLASH_ATTR tdNoiseAt( int16_t x, int16_t y )
+//Ken Perlin's reference permutation
+static const uint8_t tdPerm[256] = {
+	151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225,
+	140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148,
+	247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203, 117, 35, 11, 32,
+	57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+	74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122,
+	60, 211, 133, 230, 220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54,
+	65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89, 18, 169,
+	200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64,
+	52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+	207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213,
+	119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+	129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104,
+	218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162, 241,
+	81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+	184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93,
+	222, 114, 67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180,
+};
+
+//6t^5 - 15t^4 + 10t^3 for t = 0/256 .. 255/256, scaled by 256
+static const uint8_t tdFadeTable[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3,
+	4, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 11, 11,
+	12, 13, 13, 14, 15, 16, 17, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+	26, 27, 28, 29, 30, 32, 33, 34, 35, 36, 38, 39, 40, 42, 43, 44,
+	46, 47, 48, 50, 51, 53, 54, 56, 57, 59, 60, 62, 63, 65, 67, 68,
+	70, 72, 73, 75, 77, 78, 80, 82, 84, 85, 87, 89, 91, 92, 94, 96,
+	98, 100, 101, 103, 105, 107, 109, 111, 113, 114, 116, 118, 120, 122, 124, 126,
+	128, 129, 131, 133, 135, 137, 139, 141, 142, 144, 146, 148, 150, 152, 154, 155,
+	157, 159, 161, 163, 164, 166, 168, 170, 171, 173, 175, 177, 178, 180, 182, 183,
+	185, 187, 188, 190, 192, 193, 195, 196, 198, 199, 201, 202, 204, 205, 207, 208,
+	209, 211, 212, 213, 215, 216, 217, 219, 220, 221, 222, 223, 225, 226, 227, 228,
+	229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 238, 239, 240, 241, 242, 242,
+	243, 244, 244, 245, 246, 246, 247, 247, 248, 248, 249, 249, 250, 250, 251, 251,
+	251, 252, 252, 252, 253, 253, 253, 253, 254, 254, 254, 254, 254, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+//Gradient directions, indexed by the low 3 bits of a lattice hash
+static const int8_t tdGradX[8] = { 1, -1, 1, -1, 1, -1, 0, 0 };
+static const int8_t tdGradY[8] = { 1, 1, -1, -1, 0, 0, 1, -1 };
+
+#define TD_PERLIN_OCTAVES 5
+
+int16_t C3_VERTEX_ATTR tdNoiseAt( int16_t x, int16_t y )
 {
-	return ((x*13244321 + y * 33442927));
+	return tdPerm[(tdPerm[x & 255] + (y & 255)) & 255];
 }
 
-static inline ICACHE_FLASH_ATTR int16_t tdFade( int16_t f )
+static inline int16_t tdFade( int16_t f )
 {
-	//int16_t ft3 = (((f*f)>>8)*f)>>8;
-	//return ((ft3 * 2560)>>8) - ((((ft3 * f)>>8) * 3840)>>8) + ((((((1536 * ft3) >>8 ) * f) >>8) * f)>>8);
-	return f;
+	if( f >= 256 ) return 256;
+	if( f <= 0 ) return 0;
+	return tdFadeTable[f];
 }
 
-int16_t ICACHE_FLASH_ATTR tdFLerp( int16_t a, int16_t b, int16_t t )
+int16_t C3_VERTEX_ATTR tdFLerp( int16_t a, int16_t b, int16_t t )
 {
 	int16_t fr = tdFade( t );
-	return (a * (256-fr) + b * fr)>>8;
+	return a + (((b - a) * fr)>>8);
 }
 
-static inline int16_t ICACHE_FLASH_ATTR tdFNoiseAt( int16_t x, int16_t y )
+//Lattice corner hashes of one cell and the parts of the corner gradients that only depend on y.
+typedef struct
 {
-	int ix = x;
-	int iy = y;
-	int16_t fx = x - ix;
-	int16_t fy = y - iy;
-
-	int16_t a = tdNoiseAt( ix, iy );
-	int16_t b = tdNoiseAt( ix+1, iy );
-	int16_t c = tdNoiseAt( ix, iy+1 );
-	int16_t d = tdNoiseAt( ix+1, iy+1 );
+	int32_t cellx;
+	uint8_t h[4];	//00, 10, 01, 11
+	int32_t gy0, gy1;	//fy, fy - 256
+	int32_t v;		//faded fy
+	uint8_t row0, row1;	//lattice rows iy, iy + 1
+} tdNoiseCell;
+
+static inline void tdNoiseCellY( tdNoiseCell * c, int32_t y )
+{
+	int32_t fy = y & 255;
+	c->row0 = (y >> 8) & 255;
+	c->row1 = c->row0 + 1;
+	c->gy0 = fy;
+	c->gy1 = fy - 256;
+	c->v = tdFadeTable[fy];
+}
 
-	int16_t top = tdFLerp( a, b, fx );
-	int16_t bottom = tdFLerp( c, d, fx );
+static inline void tdNoiseCellX( tdNoiseCell * c, int32_t cellx )
+{
+	uint8_t p0 = tdPerm[cellx & 255];
+	uint8_t p1 = tdPerm[(cellx + 1) & 255];
+	c->cellx = cellx;
+	c->h[0] = tdPerm[(p0 + c->row0) & 255];
+	c->h[1] = tdPerm[(p1 + c->row0) & 255];
+	c->h[2] = tdPerm[(p0 + c->row1) & 255];
+	c->h[3] = tdPerm[(p1 + c->row1) & 255];
+}
 
-	return tdFLerp( top, bottom, fy );
+static inline int32_t tdNoiseCellSample( tdNoiseCell * c, int32_t fx )
+{
+	uint8_t h00 = c->h[0] & 7, h10 = c->h[1] & 7, h01 = c->h[2] & 7, h11 = c->h[3] & 7;
+	int32_t n00 = tdGradX[h00] * fx         + tdGradY[h00] * c->gy0;
+	int32_t n10 = tdGradX[h10] * (fx - 256) + tdGradY[h10] * c->gy0;
+	int32_t n01 = tdGradX[h01] * fx         + tdGradY[h01] * c->gy1;
+	int32_t n11 = tdGradX[h11] * (fx - 256) + tdGradY[h11] * c->gy1;
+	int32_t u = tdFadeTable[fx];
+	int32_t nx0 = n00 + (((n10 - n00) * u) >> 8);
+	int32_t nx1 = n01 + (((n11 - n01) * u) >> 8);
+	return nx0 + (((nx1 - nx0) * c->v) >> 8);
 }
 
-int16_t ICACHE_FLASH_ATTR tdPerlin2D( int16_t x, int16_t y )
+int16_t C3_VERTEX_ATTR tdNoise2D( int32_t x, int32_t y )
 {
-	int ndepth = 5;
+	tdNoiseCell c;
+	tdNoiseCellY( &c, y );
+	tdNoiseCellX( &c, x >> 8 );
+	return tdNoiseCellSample( &c, x & 255 );
+}
 
+int16_t C3_VERTEX_ATTR tdPerlin2D( int16_t x, int16_t y )
+{
 	int depth;
-	int16_t ret = 0;
-	for( depth = 0; depth < ndepth; depth++ )
+	int32_t ret = 0;
+	for( depth = 0; depth < TD_PERLIN_OCTAVES; depth++ )
 	{
-		int16_t nx = (x*256) / (256<<(ndepth-depth-1));
-		int16_t ny = (y*256) / (256<<(ndepth-depth-1));
-		ret += tdFNoiseAt( nx, ny ) / (256<<(depth+1));
+		ret += tdNoise2D( (int32_t)x << depth, (int32_t)y << depth ) >> (depth + 1);
 	}
 	return ret;
 }
 
+void C3_VERTEX_ATTR tdPerlin2DRow( int16_t x, int16_t y, int16_t step, int count, int16_t * out )
+{
+	int depth, i;
+	for( i = 0; i < count; i++ ) out[i] = 0;
+
+	for( depth = 0; depth < TD_PERLIN_OCTAVES; depth++ )
+	{
+		tdNoiseCell c;
+		int32_t sx = (int32_t)x << depth;
+		int32_t dx = (int32_t)step << depth;
+		tdNoiseCellY( &c, (int32_t)y << depth );
+		tdNoiseCellX( &c, sx >> 8 );
+		for( i = 0; i < count; i++, sx += dx )
+		{
+			//Only rehash when the sample moved into another lattice cell
+			if( (sx >> 8) != c.cellx ) tdNoiseCellX( &c, sx >> 8 );
+			out[i] += tdNoiseCellSample( &c, sx & 255 ) >> (depth + 1);
+		}
+	}
+}
@@ -18,8 +18,25 @@ void CNFGTackSegment( int x0, int y0, int x1, int y1 );
 int LABS( int x );
 extern void (*CNFGTackPixel)( int x, int y ); //Unsafe plot pixel.
 //#define CNFGTackPixelFAST( x, y ) { frontframe[(x+y*FBW)>>2] |= 2<<( (x&3)<<1 ); }  //Store in 4 bits per byte.
+//Clip-space w must be at most -TD_NEAR_CLIP for a point to be in front of the camera.
+#define TD_NEAR_CLIP 16
+
 void LocalToScreenspace( int16_t * coords_3v, int16_t * o1, int16_t * o2 );
-int16_t tdSIN( uint8_t iv );
+void LocalToClipspace( int16_t * coords_3v, int16_t * clip_4v );
+//Returns 0 if a bounding sphere (in model coordinates) is entirely outside the view frustum.
+int ICACHE_FLASH_ATTR tdSphereInFrustum( int16_t * center, int16_t radius );
+//Clips a screen-space segment to the drawable area, returns 0 if nothing is left.
+int CNFGClipSegment( int * x0, int * y0, int * x1, int * y1 );
+//Angles of tdSinCos are 65536 per turn, looked up in a quarter wave table of 2^TD_SIN_BITS entries per turn.
+#ifndef TD_SIN_BITS
+#define TD_SIN_BITS 10
+#endif
+#define TD_SIN_QUARTER (1<<(TD_SIN_BITS-2))
+#ifndef TD_SIN_LERP
+#define TD_SIN_LERP 1	//Interpolate between table entries
+#endif
+void tdSinCos( uint16_t angle, int16_t * s, int16_t * c );	//Both as 8.8 fixed point, from one lookup
+int16_t tdSIN( uint8_t iv );	//256 per turn
 int16_t tdCOS( uint8_t iv );
 
 /* Colors:
@@ -31,13 +48,18 @@ void CNFGColor( uint8_t col );
 
 void ICACHE_FLASH_ATTR tdTranslate( int16_t * f, int16_t x, int16_t y, int16_t z );		//Operates ON f
 void ICACHE_FLASH_ATTR tdScale( int16_t * f, int16_t x, int16_t y, int16_t z );			//Operates ON f
-void ICACHE_FLASH_ATTR tdRotateEA( int16_t * f, int16_t x, int16_t y, int16_t z );		//Operates ON f
+void ICACHE_FLASH_ATTR tdRotateEA( int16_t * f, int16_t x, int16_t y, int16_t z );		//Operates ON f, 256 per turn
+void ICACHE_FLASH_ATTR tdRotateEAFine( int16_t * f, uint16_t x, uint16_t y, uint16_t z );	//Operates ON f, 65536 per turn
+
+//Stroke font used by CNFGDrawText
+extern const unsigned short FontCharMap[128];
+extern const unsigned char FontCharData[949];
 
-void ICACHE_FLASH_ATTR CNFGDrawText( const char * text, int scale );
+void CNFGDrawText( const char * text, int scale );
 void ICACHE_FLASH_ATTR CNFGDrawBox(  int x1, int y1, int x2, int y2 );
-void ICACHE_FLASH_ATTR CNFGTackRectangle( short x1, short y1, short x2, short y2 );
-void ICACHE_FLASH_ATTR tdMultiply( int16_t * fin1, int16_t * fin2, int16_t * fout );
-void ICACHE_FLASH_ATTR tdPTransform( int16_t * pin, int16_t * f, int16_t * pout );
+void CNFGTackRectangle( short x1, short y1, short x2, short y2 );
+void tdMultiply( int16_t * fin1, int16_t * fin2, int16_t * fout );
+void tdPTransform( int16_t * pin, int16_t * f, int16_t * pout );
 void  td4Transform( int16_t * pin, int16_t * f, int16_t * pout );
 void ICACHE_FLASH_ATTR MakeTranslate( int x, int y, int z, int16_t * out );
 void ICACHE_FLASH_ATTR Perspective( int fovx, int aspect, int zNear, int zFar, int16_t * out );
@@ -45,11 +67,26 @@ void ICACHE_FLASH_ATTR tdIdentity( int16_t * matrix );
 void ICACHE_FLASH_ATTR MakeYRotationMatrix( uint8_t angle, int16_t * f );
 void ICACHE_FLASH_ATTR MakeXRotationMatrix( uint8_t angle, int16_t * f );
 void ICACHE_FLASH_ATTR DrawGeoSphere();
-void ICACHE_FLASH_ATTR Draw3DSegment( int16_t * c1, int16_t * c2 );
+//Fills a triangle in screen coordinates with CNFGLastColor.
+void CNFGTackTriangle( int x0, int y0, int x1, int y1, int x2, int y2 );
+//Maps an intensity 0..256 onto the gray ramp (black, gray, both striped grays, light gray, white).
+uint8_t CNFGShadeColor( int16_t intensity );
+//Returns how directly a face points at the camera, 0..256.  Use with CNFGShadeColor for flat shading.
+int16_t ICACHE_FLASH_ATTR tdFaceLight( int16_t * c1, int16_t * c2, int16_t * c3 );
+//Near-clips, projects and back-face culls a triangle.  Writes up to 4 screen vertices (and their
+//clip-space w, if w is not NULL) and returns how many there are, 0 if the face is not visible.
+int ICACHE_FLASH_ATTR tdProjectTriangle( int16_t * c1, int16_t * c2, int16_t * c3, int * sx, int * sy, int16_t * w );
+//Draws a filled triangle, faces that run counter-clockwise on screen are culled.
+void ICACHE_FLASH_ATTR Draw3DTriangle( int16_t * c1, int16_t * c2, int16_t * c3 );
+void Draw3DSegment( int16_t * c1, int16_t * c2 );
 
-int16_t ICACHE_FLASH_ATTR tdPerlin2D( int16_t x, int16_t y );
-int16_t ICACHE_FLASH_ATTR tdFLerp( int16_t a, int16_t b, int16_t t );
-int16_t ICACHE_FLASH_ATTR tdNoiseAt( int16_t x, int16_t y );
+//Noise coordinates are 8.8 fixed point, one lattice cell is 256 units.  Results stay within -256..256.
+int16_t tdPerlin2D( int16_t x, int16_t y );	//5 octaves of tdNoise2D
+//Fills out[0..count-1] with tdPerlin2D( x + i*step, y ), lattice hashes are only redone per cell.
+void tdPerlin2DRow( int16_t x, int16_t y, int16_t step, int count, int16_t * out );
+int16_t tdNoise2D( int32_t x, int32_t y );	//Single octave gradient noise
+int16_t tdFLerp( int16_t a, int16_t b, int16_t t );	//Eased lerp, t = 0..256
+int16_t tdNoiseAt( int16_t x, int16_t y );	//Lattice hash, 0..255
 
 #endif
 
@@ -0,0 +1,294 @@
+/**
+ * @file blit.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Copies bitmaps stored in flash onto the framebuffer
+ * @version 0.1.0
+ * @date 2023-03-19
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+
+// --- Includes ---
+#include "blit.h"
+#include "video_broadcast.h"
+
+// --- Defines ---
+#define BLIT_TRANSPARENT 0xff
+
+// --- Private Vars ---
+/** @brief One converted bitmap row, target colors or BLIT_TRANSPARENT */
+static uint8_t blitLine[C3_BLIT_MAX_WIDTH];
+
+// --- Private Functions ---
+/**
+ * @brief Spreads 8 bits onto the odd bits of a halfword (the double density pixel positions)
+ */
+static inline uint16_t spreadDD( uint32_t b ){
+	b = (b | (b << 4)) & 0x0f0f;
+	b = (b | (b << 2)) & 0x3333;
+	b = (b | (b << 1)) & 0x5555;
+	return b << 1;
+}
+
+/**
+ * @brief Reads 16 bits of a bitmap row starting at any bit, with aligned flash reads
+ *
+ * @param row First word of the row
+ * @param words Words in the row, nothing after the row is read
+ * @param bit Bit offset, may be negative (the missing low bits are 0)
+ */
+static inline uint32_t readBits16( const uint32_t *row, int words, int bit ){
+	if(bit < 0) return readBits16(row, words, 0) << -bit;
+	int w = bit >> 5;
+	int sh = bit & 31;
+	uint32_t v = pgm_read_dword(&row[w]) >> sh;
+	if(sh > 16 && w+1 < words) v |= pgm_read_dword(&row[w+1]) << (32 - sh);
+	return v & 0xffff;
+}
+
+/**
+ * @brief Maps a pixel value to the target color, BLIT_TRANSPARENT for the key
+ */
+static inline uint8_t mapPixel( const c3Bitmap_t *bmp, uint8_t v, uint8_t dd ){
+	if(v == bmp->key) return BLIT_TRANSPARENT;
+	if(bmp->palette != NULL) return bmp->palette[v];
+	if(dd) return v?C3_COL_DD_WHITE:C3_COL_DD_BLACK;
+	return v;
+}
+
+/**
+ * @brief Converts n pixels of a bitmap row, starting at column sx, into blitLine
+ */
+static void convertRow( const c3Bitmap_t *bmp, int sy, int sx, int n, uint8_t dd ){
+	if(bmp->format & C3_BMP_RLE){
+		const uint32_t *runs = &bmp->data[pgm_read_dword(&bmp->data[sy])];
+		int x = 0;
+		int out = 0;
+		uint32_t word = 0;
+		for(int i = 0; out < n; i++){
+			if(!(i & 3)) word = pgm_read_dword(&runs[i >> 2]);
+			uint8_t run = word & 0xff;
+			word >>= 8;
+			int len = (run >> 4) + 1;
+			uint8_t c = mapPixel(bmp, run & 0x0f, dd);
+			// Skip the part of the run left of sx
+			int skip = sx - x;
+			x += len;
+			if(skip >= len) continue;
+			if(skip > 0) len -= skip;
+			if(len > n - out) len = n - out;
+			while(len--) blitLine[out++] = c;
+		}
+		return;
+	}
+
+	int bpp = bmp->format & C3_BMP_BPP_MASK;
+	int ppw = 32 / bpp;
+	uint32_t mask = (1u << bpp) - 1;
+	const uint32_t *row = &bmp->data[sy * bmp->stride];
+	int w = sx / ppw;
+	uint32_t word = pgm_read_dword(&row[w]) >> ((sx % ppw) * bpp);
+	int left = ppw - (sx % ppw);
+	for(int out = 0; out < n; out++){
+		if(!left){
+			word = pgm_read_dword(&row[++w]);
+			left = ppw;
+		}
+		blitLine[out] = mapPixel(bmp, word & mask, dd);
+		word >>= bpp;
+		left--;
+	}
+}
+
+/**
+ * @brief Writes blitLine onto a color framebuffer row, four pixels per halfword
+ */
+static void writeColorRow( uint16_t *row, int x, int n, uint8_t flip ){
+	int end = x + n;
+	for(int h = x >> 2; h <= (end-1) >> 2; h++){
+		uint16_t v = 0;
+		uint16_t m = 0;
+		for(int p = 0; p < 4; p++){
+			int i = (h << 2) + p - x;
+			if(i < 0 || i >= n) continue;
+			uint8_t c = blitLine[flip?(n-1-i):i];
+			if(c == BLIT_TRANSPARENT) continue;
+			v |= (c & 0x0f) << (p << 2);
+			m |= 0x0f << (p << 2);
+		}
+		row[h] = (row[h] & ~m) | v;
+	}
+}
+
+/**
+ * @brief Writes blitLine onto a double density framebuffer row, eight pixels per halfword
+ */
+static void writeDDRow( uint16_t *row, int x, int n, uint8_t flip ){
+	int end = x + n;
+	for(int h = x >> 3; h <= (end-1) >> 3; h++){
+		uint32_t v = 0;
+		uint32_t m = 0;
+		for(int p = 0; p < 8; p++){
+			int i = (h << 3) + p - x;
+			if(i < 0 || i >= n) continue;
+			uint8_t c = blitLine[flip?(n-1-i):i];
+			if(c == BLIT_TRANSPARENT) continue;
+			if(c == C3_COL_DD_WHITE) v |= 1 << p;
+			m |= 1 << p;
+		}
+		row[h] = (row[h] & ~spreadDD(m)) | spreadDD(v);
+	}
+}
+
+/**
+ * @brief Writes blitLine onto a packed 1bpp row. Color pixels are two pixels wide and white if not black.
+ */
+static void writeMonoRow( uint8_t *row, int x, int n, uint8_t flip, uint8_t wide ){
+	for(int i = 0; i < n; i++){
+		uint8_t c = blitLine[flip?(n-1-i):i];
+		if(c == BLIT_TRANSPARENT) continue;
+		int px = x + i;
+		uint8_t m = 1 << (px & 7);
+		uint8_t on = (c == C3_COL_DD_WHITE);
+		if(wide){
+			px <<= 1;
+			m = 3 << (px & 7);
+			on = (c != C3_COL_BLACK);
+		}
+		if(on) row[px >> 3] |= m;
+		else row[px >> 3] &= ~m;
+	}
+}
+
+/**
+ * @brief Opaque 4bpp onto color pixels: the bitmap nibbles are stored like the framebuffer, so whole halfwords are copied
+ */
+static void copyRow4( uint16_t *row, const uint32_t *src, int words, int sx, int x, int n ){
+	int end = x + n;
+	int h0 = x >> 2;
+	int h1 = (end-1) >> 2;
+	int bit = (sx - (x & 3)) << 2;
+	for(int h = h0; h <= h1; h++, bit += 16){
+		uint16_t v = readBits16(src, words, bit);
+		if(h == h0 || h == h1){
+			uint16_t m = 0xffff;
+			if(h == h0) m &= 0xffff << ((x & 3) << 2);
+			if(h == h1) m &= 0xffff >> ((3 - ((end-1) & 3)) << 2);
+			row[h] = (row[h] & ~m) | (v & m);
+		} else {
+			row[h] = v;
+		}
+	}
+}
+
+/**
+ * @brief 1bpp onto double density pixels, 8 pixels per halfword. With transparent 0 only the set pixels are drawn.
+ */
+static void copyRow1( uint16_t *row, const uint32_t *src, int words, int sx, int x, int n, uint8_t keyed ){
+	int end = x + n;
+	int h0 = x >> 3;
+	int h1 = (end-1) >> 3;
+	int bit = sx - (x & 7);
+	for(int h = h0; h <= h1; h++, bit += 8){
+		uint32_t v = readBits16(src, words, bit) & 0xff;
+		uint32_t m = 0xff;
+		if(h == h0) m &= 0xff << (x & 7);
+		if(h == h1) m &= 0xff >> (7 - ((end-1) & 7));
+		v &= m;
+		if(keyed) row[h] |= spreadDD(v);
+		else row[h] = (row[h] & ~spreadDD(m)) | spreadDD(v);
+	}
+}
+
+/**
+ * @brief 1bpp onto a packed 1bpp row, a byte at a time. With transparent 0 only the set pixels are drawn.
+ */
+static void copyRowMono( uint8_t *row, const uint32_t *src, int words, int sx, int x, int n, uint8_t keyed ){
+	int end = x + n;
+	int b0 = x >> 3;
+	int b1 = (end-1) >> 3;
+	int bit = sx - (x & 7);
+	for(int b = b0; b <= b1; b++, bit += 8){
+		uint8_t v = readBits16(src, words, bit) & 0xff;
+		uint8_t m = 0xff;
+		if(b == b0) m &= 0xff << (x & 7);
+		if(b == b1) m &= 0xff >> (7 - ((end-1) & 7));
+		v &= m;
+		if(keyed) row[b] |= v;
+		else row[b] = (row[b] & ~m) | v;
+	}
+}
+
+/**
+ * @brief Draws rows r0..r1-1 of a source rectangle that is already clipped to the bitmap and vertically
+ * to the screen. They go onto the framebuffer or, if target is set, all onto that one line.
+ */
+static void blitRows( const c3Bitmap_t *bmp, int sx, int sy, int w, int x, int y, int r0, int r1, uint8_t flags, uint16_t *target ){
+	uint8_t dd = flags & C3_BLIT_DD;
+	uint8_t flip = flags & C3_BLIT_FLIP_X;
+	int width = dd?video_broadcast_framebuffer_width():video_broadcast_framebuffer_width()/2;
+
+	// Clip the screen rectangle, i0..i1 are the visible screen columns relative to x
+	int i0 = (x < 0)?-x:0;
+	int i1 = (x + w > width)?(width - x):w;
+	int n = i1 - i0;
+	if(n <= 0 || r0 >= r1) return;
+	if(n > C3_BLIT_MAX_WIDTH) n = C3_BLIT_MAX_WIDTH;
+
+	// First bitmap column read, the row is reversed when flipped
+	int col = flip?(sx + w - i1):(sx + i0);
+	int dx = x + i0;
+	uint8_t bpp = bmp->format & (C3_BMP_BPP_MASK | C3_BMP_RLE);
+
+	uint8_t plain = !flip && bmp->palette == NULL;
+	uint8_t fast4 = plain && !dd && bpp == C3_BMP_4BPP && bmp->key == C3_BMP_NO_KEY;
+	uint8_t fast1 = plain && dd && bpp == C3_BMP_1BPP && (bmp->key == C3_BMP_NO_KEY || bmp->key == 0);
+
+	for(int r = r0; r < r1; r++){
+		uint8_t *line = (target != NULL)?(uint8_t*)target:video_broadcast_get_line(y + r);
+		if(line == NULL) continue;
+		uint8_t mono = (target == NULL) && video_broadcast_line_mode(y + r) == C3_LINE_MONO;
+		const uint32_t *src = &bmp->data[(sy + r) * bmp->stride];
+		if(fast1){
+			if(mono) copyRowMono(line, src, bmp->stride, col, dx, n, bmp->key == 0);
+			else copyRow1((uint16_t*)line, src, bmp->stride, col, dx, n, bmp->key == 0);
+			continue;
+		}
+		if(fast4 && !mono){
+			copyRow4((uint16_t*)line, src, bmp->stride, col, dx, n);
+			continue;
+		}
+		convertRow(bmp, sy + r, col, n, dd);
+		if(mono) writeMonoRow(line, dx, n, flip, !dd);
+		else if(dd) writeDDRow((uint16_t*)line, dx, n, flip);
+		else writeColorRow((uint16_t*)line, dx, n, flip);
+	}
+}
+
+// --- Public Functions ---
+void c3BlitRegion( const c3Bitmap_t *bmp, int sx, int sy, int w, int h, int x, int y, uint8_t flags ){
+	uint8_t flip = flags & C3_BLIT_FLIP_X;
+	if(video_broadcast_get_mode() == C3_FB_EXT64) return;
+	int height = video_broadcast_framebuffer_height();
+
+	// Clip the source rectangle to the bitmap
+	if(sx < 0){ w += sx; if(!flip) x -= sx; sx = 0; }
+	if(sy < 0){ h += sy; y -= sy; sy = 0; }
+	if(sx + w > bmp->width){ if(flip) x += sx + w - bmp->width; w = bmp->width - sx; }
+	if(sy + h > bmp->height) h = bmp->height - sy;
+
+	int r0 = (y < 0)?-y:0;
+	int r1 = (y + h > height)?(height - y):h;
+	blitRows(bmp, sx, sy, w, x, y, r0, r1, flags, NULL);
+}
+
+void c3BlitLine( const c3Bitmap_t *bmp, int x, int y, uint8_t flags, uint16_t *line, int lineY ){
+	int r = lineY - y;
+	if(r < 0 || r >= bmp->height) return;
+	blitRows(bmp, 0, 0, bmp->width, x, y, r, r+1, flags, line);
+}
+
+void c3Blit( const c3Bitmap_t *bmp, int x, int y, uint8_t flags ){
+	c3BlitRegion(bmp, 0, 0, bmp->width, bmp->height, x, y, flags);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file blit.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Copies bitmaps stored in flash onto the framebuffer
+ * @version 0.1.0
+ * @date 2023-03-19
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+#ifndef ESP8266CHANNEL3BLIT_H
+#define ESP8266CHANNEL3BLIT_H
+
+// --- Includes ---
+#include <c_types.h>
+#include "common.h"
+
+// --- Defines ---
+/** @brief Bitmap formats, bits per pixel */
+#define C3_BMP_1BPP 0x01
+#define C3_BMP_2BPP 0x02
+#define C3_BMP_4BPP 0x04
+#define C3_BMP_BPP_MASK 0x07
+/** @brief Rows are run length encoded, see c3Bitmap_t */
+#define C3_BMP_RLE 0x10
+
+/** @brief c3Bitmap_t.key if the bitmap has no transparent pixel value */
+#define C3_BMP_NO_KEY 0xff
+
+/** @brief Flags for c3Blit */
+#define C3_BLIT_FLIP_X 0x01
+#define C3_BLIT_DD 0x02		// Draw onto the double density pixels instead of the color pixels
+
+#ifndef C3_BLIT_MAX_WIDTH
+/** @brief Widest row the blitter can convert, in pixels */
+#define C3_BLIT_MAX_WIDTH 256
+#endif
+
+// --- Typedefs ---
+/**
+ * @brief A bitmap in flash.
+ *
+ * Uncompressed rows start on a word boundary, stride words apart. Pixels are packed LSB first,
+ * so a 4bpp row has the same nibble order as a color framebuffer row.
+ *
+ * RLE bitmaps start with one word per row holding the word offset of that row's runs. A run
+ * is one byte, LSB first within the words: bits 7..4 are the length - 1, bits 3..0 the pixel value.
+ *
+ * Pixel values go through the palette. For C3_BLIT_DD a value without palette is white if it is not 0.
+ */
+typedef struct {
+	const uint32_t *data;		// PROGMEM
+	const uint8_t *palette;		// Pixel value to channel3ColorType_t, NULL to use the values directly
+	uint16_t width;
+	uint16_t height;
+	uint16_t stride;			// Words per row, unused for RLE
+	uint8_t format;				// C3_BMP_xBPP, optionally | C3_BMP_RLE
+	uint8_t key;				// Transparent pixel value or C3_BMP_NO_KEY
+} c3Bitmap_t;
+
+// --- Public Functions ---
+/**
+ * @brief Draws a bitmap onto the current frame, clipped to the screen
+ *
+ * On 1bpp lines (C3_FB_MONO, C3_LINE_MONO lines of C3_FB_MIXED) C3_BLIT_DD bitmaps are copied
+ * bit for bit, color pixels become two pixels wide and white if not black. Nothing is drawn in C3_FB_EXT64.
+ *
+ * @param bmp Bitmap
+ * @param x X-Coordinate of the left edge, in pixels of the target (color or double density)
+ * @param y Y-Coordinate of the top edge
+ * @param flags C3_BLIT_xxx
+ */
+void c3Blit( const c3Bitmap_t *bmp, int x, int y, uint8_t flags );
+/**
+ * @brief Draws a rectangle out of a bitmap, e.g. one sprite of a sprite sheet
+ *
+ * @param bmp Bitmap
+ * @param sx Left edge in the bitmap
+ * @param sy Top edge in the bitmap
+ * @param w Width
+ * @param h Height
+ * @param x X-Coordinate on screen
+ * @param y Y-Coordinate on screen
+ * @param flags C3_BLIT_xxx
+ */
+void c3BlitRegion( const c3Bitmap_t *bmp, int sx, int sy, int w, int h, int x, int y, uint8_t flags );
+/**
+ * @brief Draws the part of a bitmap that falls on one screen line onto a C3_FB_STANDARD line buffer,
+ * e.g. from a C3_FB_STRIP line renderer
+ *
+ * @param bmp Bitmap
+ * @param x X-Coordinate of the left edge
+ * @param y Y-Coordinate of the top edge
+ * @param flags C3_BLIT_xxx
+ * @param line The line buffer
+ * @param lineY Screen line of the buffer
+ */
+void c3BlitLine( const c3Bitmap_t *bmp, int x, int y, uint8_t flags, uint16_t *line, int lineY );
+
+#endif /* ESP8266CHANNEL3BLIT_H */
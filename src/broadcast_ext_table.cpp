@@ -0,0 +1,211 @@
+// Generated by tools/c3tablegen.py --ext-only -o src, do not edit.
+// 64 colors, index r<<4 | g<<2 | b. Carrier 61.2500 MHz, chroma 3.579545 MHz, 44 phases at 80.0 MBit/s
+#include <Arduino.h>
+#include "broadcast_tables.h"
+
+const uint32_t premodulated_ext_table[3264] PROGMEM = {
+	0x884eee27, 0x8cfc466b, 0xccd44477, 0x8e84ee27, 0xdcd6ef6f, 0xdceaeea7, 0x8cafee77, 0x8cfeae62, 0x884f4a42, 0x5cd6aea7, 0xdca54065, 0xdc554565, 0x08ea0042, 0x88ea14f7, 0x9c401443, 0xdca78542, 
+	0xadc4e562, 0xc84d4675, 0x8cac4577, 0x8c54c620, 0xadc406a7, 0x8aca4562, 0x8fed46a2, 0xcae85477, 0xa84ff457, 0x94d42d6a, 0x8aead425, 0xad405457, 0x0ac02aea, 0x80d6aad7, 0x5fefaae0, 0x0aeaa87f, 
+	0xca8ee6a5, 0xd4ace742, 0x8e8ae657, 0xcfe8e652, 0xa85c6a2e, 0x85fc6a57, 0x805eea57, 0x5ead46a0, 0x80ac2a54, 0xfd4a4002, 0x80afeaa0, 0xc05feaa2, 0x15effffe, 0x00affffe, 0xad540005, 0x94000055, 
+	0xaa8ee6aa, 0xe80c4755, 0xafdeef7a, 0xdebce615, 0xffdee2af, 0x4bd44205, 0x05fc42aa, 0x4aa84250, 0xa0856aaa, 0xd00fe000, 0xaaad6aaa, 0xc000a57f, 0xabc07aad, 0x555f5554, 0x505fffaf, 0x00000000, 
+	0x77b1118b, 0x723bb958, 0x7a311959, 0xa23bb8bd, 0x73f111d5, 0x2171158b, 0xf535195a, 0xab711d01, 0x3552b9d5, 0x52ab1a8a, 0x3f53594b, 0x3f57b8aa, 0x3fd7108a, 0x78035bca, 0x5057b8af, 0x15571df5, 
+	0x53301b89, 0x773ba91d, 0x6b315bd9, 0x22b395f9, 0x521291a8, 0xa3512958, 0xa2b101fd, 0xf5211d01, 0x7a0151ad, 0x3552b80a, 0x2ab515aa, 0x002b0955, 0x2bff51d4, 0x5142b80a, 0x3d57bd55, 0x005515ff, 
+	0x7239011d, 0xa330ba99, 0xe33a9018, 0xf73bd518, 0x2b152908, 0xf71501a8, 0xf7b50bf8, 0x2a13d509, 0x35283a9e, 0x52abfa95, 0x2a15015f, 0xaa0150ab, 0x2bd57bd4, 0x1555514a, 0x2aaab5fe, 0x0002bd57, 
+	0x77bbfa98, 0x6310b518, 0x433bd798, 0x6211ffbd, 0x6b100388, 0x77bffa90, 0x5715aab8, 0x5710001a, 0x7f1ff51c, 0x2015551e, 0xa2bd5295, 0xeb55aa0b, 0x750af15e, 0x2bd57fad, 0xfaaaabff, 0x00000000, 
+	0xcdc446f7, 0x8deeee6b, 0xdc4fee62, 0x8ceac6f7, 0xddeeea42, 0xdceaef42, 0x88eeaea7, 0xdc4a5467, 0xfdc42fe5, 0x94ca542f, 0xdd440042, 0x9ca40042, 0x0a8e7fc7, 0xb8ef5546, 0xa8d6aaaf, 0x58ea28f6, 
+	0xcacae6f7, 0xdecaee27, 0x4dec56e3, 0xc845ee77, 0x85c5e6a5, 0xaded6e02, 0x84854562, 0xded6d477, 0xfde86a06, 0x8ad4556a, 0x8ad6fea5, 0x5de55457, 0x15c57ffe, 0xa9440145, 0x5ad6aaaf, 0xa856a807, 
+	0xcd5eee22, 0xed4aee75, 0x8fe84652, 0x84afc675, 0x805c4257, 0x85fc42f5, 0x85ead657, 0x5c554420, 0x800d6555, 0xe80a402f, 0xd54af402, 0xd4aa5f42, 0x014fe14a, 0xaa8557d6, 0xbfc02aaf, 0xfd40156a, 
+	0x84a8e62a, 0xcafcef75, 0xac00ee21, 0xcd55ee72, 0xafd4ea2a, 0xd40aef7f, 0xd40ad62a, 0xdeaac070, 0x050d6f00, 0x8000e02a, 0x4aaafeb5, 0xc0005f57, 0xab487faa, 0x57d54155, 0xf554a00a, 0x00000000, 
+	0x723bb9a8, 0x723bb9a8, 0x17351981, 0x22b3b895, 0x37b5118a, 0x23a111d5, 0x217b158a, 0x01729bdd, 0x73aa118a, 0x717fb09e, 0x35a129ad, 0x3aa2b9d5, 0x7bff5185, 0xb1557b8e, 0x714a39fc, 0x1007ba85, 
+	0x631291a8, 0x523bb818, 0x7533a9a9, 0x57b309f9, 0x72b15b8b, 0x203b5bda, 0x035291fd, 0xf02b180b, 0xb7bfa1a8, 0x2b50101d, 0x7ab515a8, 0x52ab5bd5, 0x215f515c, 0x21557a8a, 0x7aaab585, 0x50a03d5e, 
+	0xa23b951d, 0x7713d0b8, 0x2f31581a, 0x7f7b90bd, 0xf710151d, 0x7535bf80, 0xf535bf80, 0x2a1795f8, 0x77abfabd, 0x57abfabd, 0xa017a815, 0xab551555, 0x53fd7abc, 0xa155550a, 0x5555500a, 0xabf415ff, 
+	0x573b8159, 0x5731aab8, 0x6a31a810, 0xaa310aa9, 0xa7115509, 0xe2bbaabd, 0xa535a950, 0x02010abd, 0x7f155514, 0xa5295500, 0x42baaabd, 0xff550ab5, 0xf500a01f, 0x6bffebfd, 0xa00aabff, 0x00000000, 
+	0x8c84466a, 0x88ec6ea7, 0xdcc56e42, 0xdcc54427, 0x8dec5656, 0xdd4ef476, 0x88ed6a47, 0x08c56ae2, 0xd5d46f42, 0x808456a5, 0x58fef56f, 0x5ace0006, 0xf5de6aaa, 0xa9d47554, 0x29c5754a, 0x50d470ae, 
+	0x8cac46a2, 0x8d44a462, 0xdec54462, 0x48c6d462, 0xcacae560, 0x8fc4a425, 0xacaed6a7, 0xdd440565, 0xfd4ae556, 0x4a84a557, 0x00d457ea, 0x5fc556af, 0x00a86a0a, 0xd00ea005, 0x50aea00a, 0xbd5e0142, 
+	0xdc54ee22, 0x8c04ae63, 0x8cfe8662, 0x8aefeef7, 0xd404ae75, 0x8ae84077, 0x8ad40422, 0x0840546b, 0xea85e57f, 0x4aad4255, 0xfc054057, 0xfd405542, 0xa00aea14, 0xaaad57ff, 0xaaad7ffe, 0xffd57fea, 
+	0xd44ac6a3, 0x8efd4477, 0x8c55ee77, 0x8c554a62, 0xe855ee20, 0xd455ee2a, 0x85ea86a2, 0x0c000475, 0x8555ef7f, 0x8555ea52, 0x54aaaf55, 0xfc00007f, 0xeabd420a, 0x55554015, 0xffffff55, 0x00000000, 
+	0x373b1bd8, 0x232bb995, 0x32131a88, 0x72b1389f, 0x213a11d8, 0xa315395d, 0x7153b588, 0x21035994, 0xf3015108, 0x72bab09f, 0x72953588, 0x3001790d, 0x7515529d, 0x23aaa18a, 0x715f510d, 0x35aa018a, 
+	0x237b9090, 0x35211958, 0x1717b9da, 0x3a2b19d5, 0x235101a8, 0x72b5ba9d, 0x52b2b8bd, 0x2153595d, 0xa3b550bd, 0x570150bd, 0x2b5515a8, 0x7ab551fd, 0x521af01d, 0x7500015a, 0x7abff0bc, 0xf154290f, 
+	0xa23b95bd, 0x577b90bd, 0xab711a81, 0x2a131d5a, 0x573a951d, 0xf5210bd0, 0xa03fb80b, 0x7ff101fd, 0xf7b5aab8, 0x7f2a950a, 0xf501500b, 0xb555155f, 0x021fffa9, 0xf7f82aa8, 0xab5ffaa8, 0xabfff5aa, 
+	0x577195a9, 0x022b9aa9, 0xaa211801, 0xbf711d55, 0x02129fab, 0xa0315ff9, 0xaa1295fa, 0x00210955, 0xea115415, 0xaf515ffa, 0x7ff00abf, 0xa5501555, 0xaa3d4015, 0x42bd57fd, 0x4015557d, 0x00000000, 
+	0x8d4eee76, 0xc8c442e2, 0x9cd46457, 0xddc46a6f, 0xadeca657, 0xd48ee2f6, 0xa8846a56, 0xbdc47406, 0xfd486f7e, 0xd5ec56aa, 0x00845740, 0x55cea2ae, 0xeb484700, 0xffdc7554, 0x415c6000, 0xa14c7fad, 
+	0x8cd44427, 0x884eae62, 0x88c42ef6, 0x88eeaf47, 0x8ac046a7, 0x5caed657, 0x5caefe07, 0x58efe042, 0xd40aef7f, 0xfc0ae557, 0x0ad456aa, 0x55c56aaf, 0xeabc5614, 0xd7d4f57d, 0x000aeb54, 0xffd45500, 
+	0x8c54ea67, 0x8d440462, 0xdceafe42, 0x9ceffe42, 0x5c54ae75, 0x8aeaefe2, 0xded40565, 0x5d4f4042, 0xae80a420, 0x805eaf42, 0xd40a542f, 0xd5eaffea, 0x455aea00, 0xaaaaaf55, 0x000aa555, 0xffd557fe, 
+	0x8c054477, 0x8c540e62, 0xdce00e43, 0x9c42d462, 0xc8400e75, 0x4d405e6b, 0x88568562, 0x0d455457, 0xdeaa86a1, 0x8a554f57, 0xd4aaaa57, 0x5eaaafeb, 0xd6bfc2a0, 0x55554a15, 0x55555555, 0x00000000, 
+	0x2b311098, 0x2312b998, 0x732bb908, 0x7317b994, 0x61301bd9, 0x212bb59d, 0x23bf159d, 0x37bfb09d, 0x2b2babd9, 0x22babf9d, 0x735ab59a, 0x2100129c, 0x613d5518, 0x22b80298, 0x7515579d, 0x77bd6b9e, 
+	0x22b11bda, 0xb72bb9a8, 0x32b5118a, 0x73fb39d5, 0xa213a958, 0x5712b81d, 0x703fba9e, 0x2150395d, 0x43515ab8, 0xf7b5aba8, 0x52bab5a8, 0x750015bc, 0x0210aa1a, 0x6b28015a, 0x2a1fffbd, 0x750aa15d, 
+	0x02b3b8a9, 0x17a391d5, 0x302b195d, 0x302b1bdf, 0x7f2b90a9, 0xb52115fd, 0x2b52b8bd, 0x17ab51d5, 0x02150bf8, 0xab52955a, 0xa2abfa80, 0x03ffabd5, 0x053fd529, 0x42bfd528, 0x57fd02a8, 0xab554155, 
+	0x50239955, 0xbf53b8a9, 0x2a1719e9, 0xb0531a8a, 0x2a5395fa, 0x50211fd5, 0xaab795fd, 0x5003594b, 0x56b01ea9, 0xff5294b5, 0xfff015f5, 0x55551555, 0xaa515e01, 0x543fd552, 0x5550002a, 0x00000000, 
+	0x8acee427, 0x5cdee6f7, 0x8acee426, 0x884c4256, 0x4ded467f, 0xd4ac47e2, 0x48ac4256, 0x4a8c6556, 0x4fd4e575, 0x4a84ea2a, 0xc0ad4600, 0xaa8ef42a, 0xaf5d462b, 0x5f5c0615, 0x4280e52a, 0x878ae528, 
+	0x8ccae476, 0x884ef465, 0x8dc456a6, 0xd48e47e7, 0x85c54422, 0xfcaed657, 0x885eea57, 0xfd4eff42, 0xac05ee03, 0xad54fe2a, 0xad5ea402, 0xaa8547ff, 0xde0a8601, 0xd555e57f, 0x450aea00, 0x4154f555, 
+	0xdceaeae2, 0x88445462, 0x5dc6fef6, 0xd5c46ae2, 0x5cfeaef7, 0xadeeaea7, 0x5d44056a, 0xfdeeaaf6, 0x0d40042a, 0x85feaf42, 0xa805407f, 0x54ad56aa, 0x4fffd6a0, 0xaaa0fe01, 0x055feaab, 0xebffea0a, 
+	0x8de40462, 0x5cc5546a, 0x5dee54f6, 0xbcc57eea, 0x88455443, 0x08ea5ea7, 0x08405547, 0xfdef5456, 0x0d6aad62, 0xd540056a, 0xfd400057, 0x5feaffea, 0xd42bc07a, 0x85555401, 0x802aafff, 0x00000000, 
+	0x7213b9d9, 0x77113958, 0xb335119d, 0x23101198, 0x77b101a9, 0xa33fbd1d, 0xb73a9108, 0x23abab9d, 0x6b35bfa9, 0x5711551d, 0x253a951d, 0xf71aabbd, 0xea31d7f9, 0x43795f0b, 0xf7b5d7bd, 0x5710a51a, 
+	0x123b109d, 0x3712b995, 0x32b01188, 0x7512b908, 0x0213a9a8, 0x7f2bbd09, 0x752ba908, 0x7b517bd8, 0x42b15aa9, 0x02101558, 0xa2baabda, 0x435abfa8, 0x56115415, 0xff795550, 0x0215ffa9, 0x43fa82bd, 
+	0x32b7b9df, 0x2ba3b9fd, 0x32ab109d, 0x7b50398a, 0x2ab79095, 0xa2b51580, 0x2152ba89, 0xb7ab51d5, 0x02b51ffd, 0xab52bd55, 0x552bfaa8, 0x02bffa95, 0x002bad50, 0x403fad50, 0xeb55055a, 0xa0155550, 
+	0x1523b880, 0x316b19fd, 0x30a139d5, 0x3283108a, 0x7aa3a9e9, 0x017f1a80, 0x2bf529d5, 0xb002b95e, 0xbea10a81, 0x1417a941, 0x5555154b, 0xb55550aa, 0xaaf01eab, 0x556bd555, 0xfffffd52, 0x00000000, 
+	0x48c446f7, 0xdcac6476, 0x48ece7e2, 0x5cac462a, 0xc84ae477, 0xded4ef60, 0x85e8462f, 0xe80c4257, 0xcfe84422, 0xd45fee7a, 0xfe85e420, 0xc55fee2a, 0xc5554e21, 0xcfffc435, 0xd6a80650, 0xc500c278, 
+	0x5ccea46a, 0xdcaee567, 0xa8ca4607, 0xd5cee57e, 0x94d6efe2, 0xe8e84242, 0xa85eef6a, 0x5fcae7f4, 0xd4afea43, 0xa854a42a, 0x85fed6a0, 0x855eaf57, 0x84a0aea3, 0x85554a7f, 0x4a00fe03, 0xeabe87f5, 
+	0x88c6fef6, 0xfdc46ae2, 0x5d4ee056, 0xa8cea7ea, 0xadeeaf47, 0xa8ed6af6, 0x548457e5, 0xfd4fe556, 0x0d40542f, 0x85eaafe2, 0xaad5407f, 0x4aad42aa, 0x087fd42a, 0x0affd56b, 0xaaffd6aa, 0x5555402a, 
+	0xbccf406f, 0x58c42ae7, 0x5dc425e5, 0xa8846006, 0x58440042, 0xa8ae5547, 0x5acf556f, 0xa9eea054, 0x5d42ad6a, 0x5e855542, 0xfd405556, 0xa80f5540, 0xfd42bc2f, 0x05f554a0, 0xad550055, 0x00000000, 
+	0x723bb958, 0x2315119d, 0x753bba98, 0x732bbd18, 0x573b5958, 0x23511595, 0x7f3babd9, 0xf73bd298, 0xaa3ba950, 0x023bfd0b, 0x023bd509, 0xa2115f59, 0x56129ffb, 0x56b15d79, 0x0530beba, 0x0751aff9, 
+	0x3353b908, 0x753b5b9d, 0x77b1519d, 0x23101108, 0x2b53bdbd, 0x035115a9, 0x032bd158, 0x23fbfbd8, 0x57f10095, 0x02b155a9, 0x2a12955a, 0xe17bffa8, 0xfeb29fff, 0xaf515aa0, 0xea015ffa, 0xff795410, 
+	0x32bf1188, 0x23ab5188, 0x37bfb1d8, 0x730b519d, 0x2157b95d, 0x03a151d5, 0x7012bf88, 0xb7b5515d, 0x2aa101e9, 0xb557bd5f, 0x552bfaa8, 0x553fff80, 0x1403a855, 0x5557a800, 0xaab55ffa, 0xaffaaaaa, 
+	0x32b539ad, 0x7ba0398a, 0x73ab5188, 0x7b0a118a, 0x35a039d5, 0x7aab51df, 0x7b5551ad, 0x37aaab8a, 0x3fff15d5, 0x1557a954, 0xb55550a8, 0x2bfffa95, 0x0aa515ea, 0x15429555, 0x0002a800, 0x00000000, 
+	0x8c844676, 0xdedee6f7, 0xdc5c4675, 0xc8fc4675, 0x8ac54477, 0xdc4aee25, 0xd45ec602, 0x84a8462a, 0x8d454a62, 0xdc540e75, 0x5c554475, 0xc055ee20, 0xdc7fe863, 0x48414a61, 0x8c2a8421, 0x4d7fca75, 
+	0x85cee567, 0xe8cea6f6, 0x485c6425, 0xdfcae657, 0x5cd6ea42, 0xd4d456f7, 0x85e847f6, 0x0fc0e575, 0xadeffe57, 0x4854042f, 0x8fe85420, 0x8554ae2a, 0x8aeaa861, 0x94555e57, 0x8af5fea2, 0xaff5ea57, 
+	0x5dce42f6, 0xa8d4642f, 0x5fcc6a2f, 0x4084e7f4, 0x5d4ea56f, 0xd5c542f6, 0x0adef42a, 0xe80ae57e, 0x5d45542f, 0xadeaffe2, 0xaad5407f, 0xaad542ff, 0x0857fc2f, 0x14a55fe1, 0xad55556a, 0x80000555, 
+	0xfdc46aa4, 0xd0de6f45, 0x55cc7f56, 0xd5844205, 0x5d4ea056, 0xfded6aa5, 0x5fcae16a, 0xd00ef556, 0x50d6a056, 0xbfc55556, 0x154a5556, 0x55545555, 0x1fc7aaaf, 0x55f41540, 0x00aa0aaa, 0x00000000, 
+	0xb7311bd8, 0x773bbd18, 0x773b9018, 0x773ba91d, 0x7f35b9a8, 0x75315bda, 0x037b95bd, 0x0231a95b, 0xb57115d5, 0x2a2bb8ab, 0x2a2b95fa, 0x0213d5ab, 0x5f52b8aa, 0x5571582a, 0x54351d57, 0x0a71a87a, 
+	0x753bb59d, 0x21351b89, 0x723ba91d, 0x573bab9d, 0x217bbf89, 0x571790bd, 0xb70115a9, 0x6121abd0, 0x7fa129fd, 0x2ab515a8, 0x2a12955a, 0xaa3a9550, 0x7d7f1d55, 0xaaa100aa, 0xaaa15aff, 0xd57abd6b, 
+	0x712bfb9c, 0x771011a8, 0x63bab1a8, 0x2315011d, 0x7152bbdd, 0xa3ab51da, 0x521015bd, 0xb70150bd, 0x7aab5bd5, 0xa157a95f, 0x552bfa80, 0x552bffa8, 0x00a178aa, 0x7fff0aaa, 0xaaabffd5, 0x02faaaaa, 
+	0x33503908, 0x73157b88, 0x7510151d, 0x7710a198, 0x7baa11ad, 0x72bffb8a, 0x521fa1a8, 0xa3faaba8, 0xb505290d, 0xb502abdf, 0xa155500a, 0x7f5aabfd, 0x5005294a, 0x2a803fd4, 0xabff5554, 0x00000000, 
+	0x884eee26, 0xdce84662, 0x8cfec677, 0xdc54ee77, 0x9ecfe426, 0x8c8406f7, 0x8ed40463, 0xccafc6f2, 0x8ac55462, 0xdc4aaea2, 0x88e05e6b, 0xdc554425, 0x9d47fd67, 0x9c56a86a, 0x8842ad65, 0x8843d461, 
+	0xd4cae656, 0xe8eca657, 0xcacae477, 0xd4fc46a2, 0x48feef42, 0xd48456f6, 0xd4fed657, 0x8d40ea75, 0x5deff456, 0x084a5f42, 0x8ad6aea5, 0x8affea43, 0x58455547, 0x94af5fe2, 0x8aff5ea7, 0xdeaaaae1, 
+	0x80cae607, 0xdfceea25, 0xde84ef7f, 0xc5fc462a, 0x5fcea56a, 0xd5c047f4, 0xe80eae2a, 0xd40aef7f, 0xfd4a4007, 0xd5eafea0, 0xa8054057, 0x0affea55, 0x0a843e87, 0xa8a55542, 0x00ff5ff5, 0x80550557, 
+	0xd5d4642f, 0xd54ce2aa, 0xc00c4755, 0x4a94e614, 0x4bcea7fe, 0xd55c6a00, 0xffdef6aa, 0xd55eaf7f, 0x785ef554, 0xffd457fe, 0xaa8542aa, 0x5554a555, 0x15eaa14a, 0x3d542a80, 0x00aaaaaa, 0x00000000, 
+	0x353111d9, 0xa3310b9d, 0x57311f95, 0x52311d1d, 0xb2b3a995, 0x752bb9f8, 0x57539095, 0x0213bdf9, 0xb52b1080, 0x3f52b9fd, 0x7aa3bdfd, 0x16b79a81, 0x50a3bd5f, 0x3af51087, 0x3d6b1ad7, 0x28751857, 
+	0x2312b908, 0x631291a8, 0xf73ba909, 0x023b95b8, 0x212bb59d, 0xb7b510bd, 0x5712bdbd, 0x7f2b95a9, 0x12ab1580, 0x2ab515ad, 0x2ab515a8, 0x557ab801, 0x0142b94a, 0xb54290aa, 0xaaab5aaa, 0x5557bd41, 
+	0x63b0b1a8, 0x77395109, 0x63b015bd, 0xa23b8159, 0x712bfb8a, 0x23ababa8, 0x52101509, 0x42b1fabd, 0x52abfbdf, 0x2015015d, 0xf501500a, 0x7ff155fa, 0xa1543a8a, 0xabff50aa, 0x7fff5aaf, 0xffebfaff, 
+	0x63babf98, 0x7710ab98, 0x6310b51d, 0x2711ffb8, 0x5301529d, 0x72baab94, 0xf215ab58, 0xe2bbebd0, 0x215a010a, 0xa3fd529f, 0xf515550a, 0x57faaabd, 0x7a802bd4, 0x2bfeb55e, 0xaaaaaa94, 0x00000000, 
+	0xe8c446f7, 0x8c0eee27, 0xdcc45462, 0x8c5eee57, 0xd4ceae07, 0x8ac40476, 0x8d440477, 0x5cefeea7, 0xa8c56aea, 0x5deeaae2, 0x08effef7, 0x5cfe0ae2, 0xf8c57aea, 0x80c57d47, 0x80c7faef, 0x8842a842, 
+	0x8d4eee25, 0x8d4ec765, 0xc854e477, 0x8c54ae63, 0x5edee56a, 0xd4ac5657, 0xacafee2f, 0xacafeea2, 0xa8aef542, 0xa84af407, 0x0854056a, 0x5c54006a, 0xa94e0147, 0xa8aeb545, 0xa8a41407, 0x5fefaaeb, 
+	0xde8eee20, 0xc5e8467f, 0xc854ee20, 0xcae84422, 0x85d44756, 0x85e84257, 0x4d54f475, 0xd4aaea6b, 0xfd4ae005, 0x55e86aaa, 0x8aafeaf5, 0x85f4aa57, 0x50aea005, 0xaa857fea, 0xaad57fea, 0xd0555556, 
+	0xd548462a, 0xd55eee35, 0xca5ca67f, 0xcaaac620, 0xea8ae6be, 0x855c5600, 0xfe80ea20, 0x8554ae2a, 0xd7def555, 0xea8042aa, 0x8000f56a, 0x4aaaaff5, 0x014af50a, 0xabd42aa8, 0x17d56a95, 0x00000000, 
+	0x723bb908, 0x75311bd8, 0x37b3b8bd, 0x22b39bda, 0x73f1109a, 0x1717b9fd, 0x7f03b895, 0x2b531d0a, 0x37ab158a, 0x2ba011df, 0x52ab1080, 0x3ff51bcb, 0x35003bde, 0x5157ab8f, 0x35ff29d5, 0x1057b85f, 
+	0x723b9018, 0x22139590, 0xa23bbdbd, 0x5721b8bd, 0x23fbb594, 0x7f2bbd09, 0x2a3ab95f, 0x17f395f8, 0x7a1501a8, 0x52bf01d5, 0x2bf51580, 0x157a1a80, 0xf2943a8a, 0x714b514a, 0xf0aa10ad, 0x5002bad5, 
+	0x223901bd, 0x7751bd18, 0x2a31bd15, 0xab71bd09, 0xa3515ba8, 0xf70101f8, 0x57179559, 0x57f10abd, 0x72bffa9f, 0x2a15015d, 0x7fa155aa, 0xff5015fd, 0x755ff0bc, 0xa155528a, 0xa1557d5f, 0xbfff55ff, 
+	0x27b1fa99, 0x6211abf9, 0xf779bfa9, 0x073bd515, 0xa3295518, 0x253a8101, 0x5701aab8, 0xaa3bd501, 0x61280100, 0xf53d5515, 0xaa155fa9, 0x557aa815, 0x57a85295, 0x7aaaaabd, 0x6bffebff, 0x00000000, 
+	0x8dec6e62, 0x884eea67, 0x8caeee57, 0x8dc6eea7, 0xdd4eea6a, 0xdd4ef46a, 0xdac45426, 0x9cea4a42, 0x80846a56, 0xd0c402ea, 0x08ae556f, 0x5dee0042, 0xa94ef55e, 0xfacea145, 0x50d47aae, 0x5acf5056, 
+	0xdc5eee77, 0xdce846f7, 0x8c044f67, 0x8d445e62, 0x8acae420, 0xe8fc6a42, 0xdcaeae07, 0x08effe42, 0xaadef6aa, 0xd5e86aa5, 0x0ad456af, 0x085e0542, 0xf80ea505, 0xa80ea00a, 0x280e0005, 0x50ae00af, 
+	0xcd4aee77, 0x8fed4657, 0xcdeaee75, 0x8eafc477, 0x85e84756, 0x85eac7f7, 0x48540425, 0xad454a6b, 0xd54aea2a, 0x55eaeaa0, 0x80feaff5, 0x0afeaaf5, 0x000ae014, 0xaaa87fff, 0xfaafebea, 0xffd6aaaf, 
+	0xc54ac67a, 0xcc00ee21, 0xc87c0477, 0xdc40ae77, 0xd6a8e435, 0xcffe8652, 0xad40ae2b, 0xd4554f6b, 0xd554af7f, 0xeaad402a, 0x4005eaa0, 0x5eaaaff5, 0xe01eaf00, 0x6aa85528, 0xeaa80000, 0x00000000, 
+	0xa33b1bd8, 0x753b1bd8, 0x232b19a8, 0x23f3b9da, 0x231511a8, 0x37b511da, 0x3f17b95d, 0x352b108a, 0xa31551bc, 0x212abbdd, 0x7157ba9e, 0x21a53948, 0x23802b88, 0x72957bdd, 0x35aa10bc, 0x2bd57bde, 
+	0x6b310b95, 0x22b39595, 0x52b3b8a9, 0x1753b895, 0x221151d0, 0x2b53a958, 0x2a12b95d, 0x3fa3a9ad, 0x7512ab8a, 0x75152908, 0x52bfb580, 0x17ffba80, 0x75156b88, 0x75bff01c, 0x700a01ad, 0x7a803f8f, 
+	0xf73ba959, 0x7f310bd0, 0x7f21b8bd, 0x02b3bdfa, 0xa3510bf8, 0xf7a10bd0, 0x2a3ab80b, 0x7f5290a9, 0xf7bfaabd, 0x2515015a, 0x7f5015aa, 0x7ffa1fad, 0x021fffbc, 0xf7fd5014, 0xa155550a, 0xfaaaabfd, 
+	0x0231a951, 0x6a31bd51, 0x053380bd, 0xaf7b90fb, 0x577b8010, 0xaf359550, 0x56b15aab, 0x55715aab, 0xea114b5a, 0xa03f82a9, 0x02abd001, 0x557fa801, 0xf528a015, 0x57aaafa8, 0x00155555, 0x00000000, 
+	0x884eee27, 0x8acee567, 0x88ec6a47, 0x88eeea6f, 0xdfceea74, 0xdd4c6a56, 0xfdc46af6, 0x88ae42ea, 0xad486f6a, 0x5fcea7ea, 0x808457ea, 0x008e6aae, 0x55ac4214, 0x695c6014, 0x508402aa, 0xabcd615e, 
+	0xcdc44427, 0xdced46f7, 0xdceaeea7, 0x88445462, 0x8d4ae422, 0xaded6e07, 0x5caefea7, 0x08efea56, 0xdfd442f5, 0x05d456a0, 0xaade556a, 0x0ade5556, 0x0284a550, 0x000ae000, 0x555c2a0a, 0xf0ac2aaa, 
+	0xdec04e22, 0x8defee61, 0x8ac54427, 0x88eeaea7, 0x8aeac577, 0x8ae856f7, 0xded40425, 0x5c5e0542, 0xd40aea52, 0x8554a42a, 0x85feaff5, 0x05eaffea, 0x055aea00, 0xaaa857ff, 0xaaaaffff, 0x7fd40156, 
+	0xcca5ee63, 0xccafc422, 0x9eeaae62, 0xdce05e43, 0x8efd4422, 0x8aea8422, 0xdc555477, 0xdeffeae2, 0x8f54ae03, 0xeafd407a, 0x4ad2d42a, 0x5eaaaff5, 0xeabfef50, 0x0500057d, 0x55555415, 0x00000000, 
+	0x77b1118b, 0x72b11189, 0x2317b99e, 0x2317b99e, 0x23129108, 0x213fbbd8, 0x2b17ba9d, 0x23b5299d, 0xf3295108, 0x72baab9d, 0x23aabb80, 0x2bbff18a, 0x753d5518, 0x72bd5298, 0x571ff5bc, 0x715af108, 
+	0x523bb9f8, 0x7031109f, 0x23f111d5, 0x2b03b9ad, 0xf2b101a8, 0x7a3ab95a, 0x5352b95d, 0x3503f908, 0x6b290158, 0x75150108, 0x53555ba8, 0x03aab594, 0x75295515, 0x521afa1d, 0x52bfffbc, 0xf294178a, 
+	0x023bb8a9, 0x7521195d, 0x2ab3b80a, 0x215315df, 0xf7f11fd0, 0x57a115f8, 0x2a17bda8, 0x2bf2b8a8, 0xa52b8150, 0xa03aa950, 0x7f5015aa, 0x2abfabfd, 0x07b5fff8, 0xf5500015, 0xf5500014, 0xabfff5aa, 
+	0xff71180b, 0x15739a81, 0xbf711fd5, 0x2a0318aa, 0x963bf851, 0xbe3b5801, 0xff53f8ab, 0xbff290aa, 0xea178ab5, 0xa5510050, 0xb4178000, 0x7fff0aaa, 0xa57a8551, 0x557a852a, 0x56a9557f, 0x00000000, 
+	0xcdc44656, 0x48c446a7, 0x88cef6f6, 0x88ca6e56, 0x8fc4ea76, 0xadec42f6, 0xe8844256, 0x55cef6a5, 0xad5eef7f, 0x4aacf6a0, 0xd55ee57e, 0xd5ac4200, 0xeaa8e520, 0x40084700, 0xaaa84700, 0x57def57d, 
+	0x88eefe67, 0xdcc54476, 0xddeee56f, 0xa8c46ae2, 0x8ac04562, 0xdd4ea425, 0x5d4ea42f, 0x5acea542, 0x0fe84575, 0x0fd44025, 0xffd442af, 0xaa84a555, 0xc2a84520, 0x4a0ac2b4, 0xaa085755, 0xffad42be, 
+	0x8d440462, 0x0cca5467, 0x88c56ae7, 0x88eeaa47, 0x88405462, 0xa8eaea42, 0x08fea407, 0x1e84556a, 0x8540fe52, 0xad40a42a, 0x85feaff5, 0x55eaff40, 0x0f55eff0, 0xeaa8057a, 0xaaaaafff, 0xffd557fe, 
+	0xdceafe67, 0xacc55467, 0x94c6a867, 0x9cea54e2, 0xdeeaac77, 0x5cf40f42, 0xd4d6a860, 0x94d6aaeb, 0xdea0aea2, 0x80554a57, 0xa8055402, 0x80af5ff4, 0x4ff5d42b, 0x85555eb5, 0xd57fe82a, 0x00000000, 
+	0x323bb908, 0x721139a8, 0x2315119d, 0x3710119d, 0xa32b95bd, 0xb73ab958, 0x22bbfb88, 0x73515108, 0x6b2b9515, 0x753bff95, 0xa3155158, 0x77bafba8, 0xf7100a1a, 0x573d5515, 0x4315f51d, 0x62b8551a, 
+	0x537bb9a8, 0x353f19a8, 0x73a139da, 0x712ab99d, 0x0353a9a9, 0x753b5bda, 0x703aba9d, 0x7b50115d, 0x7f2ba950, 0x5715015a, 0x57155bf8, 0x77bffa95, 0x07a1afa9, 0x02b5afa9, 0x42baaabd, 0xa2bd57a8, 
+	0x3a2b19d0, 0x2b531a8a, 0x21531588, 0x212b5188, 0xb57b1fd5, 0x17f101d5, 0x52b51580, 0x2152ba8a, 0xa02bbd55, 0x003fbfd5, 0x7f5015aa, 0x2b5550bd, 0x057bd550, 0xa5515555, 0xff00000b, 0xaabffffa, 
+	0xa17519aa, 0x15713d85, 0x2bf539df, 0x3aa13894, 0x00211fd5, 0x3ff51a80, 0x3fa2b8a8, 0x7002b80a, 0xbea11eab, 0xaa5150a0, 0xabf500aa, 0x3fffabe9, 0xfeaba87a, 0x54015ff5, 0x802a8001, 0x00000000, 
+	0x8dec4657, 0xdc844657, 0xe8dee656, 0xe8dee607, 0xdc4aee75, 0x85eca657, 0xad4c42f5, 0xd5d4462a, 0xcd54ea75, 0xcafc4575, 0xd554ef7f, 0xd4084755, 0x8eaad652, 0xcf5fc617, 0x4a00c750, 0xc014ea29, 
+	0x88eefe42, 0x88ec06a7, 0x8acee06a, 0x5d4c6a56, 0xd4e842e2, 0x8ac54425, 0x5d4ea42a, 0xe8ac56a0, 0x8fead657, 0xde8042f7, 0xafe84025, 0xe80ae02a, 0x4affc575, 0xeaaad6a1, 0xfebfef55, 0xaf5aef50, 
+	0x9cefea47, 0x88c56fe7, 0x08d6e542, 0x0acc2547, 0x88454062, 0xadeeafe7, 0xa8eaeaa7, 0x80ac7f42, 0x85eaaea2, 0xad405e02, 0x85feaff5, 0x554af556, 0x0d7fd420, 0xafffeaf5, 0xe828057f, 0xd5555415, 
+	0x88c6aae7, 0xa8ce006f, 0xf8c47fe6, 0x1deea042, 0x08ef5442, 0xbc86aae2, 0x14d452ea, 0xa8aea056, 0xde87fc2f, 0xa8540057, 0x94aa5ff4, 0x7d405555, 0x94578543, 0xaaf55ea0, 0x54000000, 0x00000000, 
+	0x7321b9bd, 0x723bb958, 0x23115198, 0x77115198, 0x77b3a9a9, 0x6b30ba98, 0x77115158, 0x57395109, 0x7f7b9559, 0x7f21a950, 0x57290018, 0x6b3a83f8, 0xaf7b8ab0, 0xd63bd550, 0x0729aa01, 0x4239403d, 
+	0x32131588, 0x7351395d, 0x23101194, 0x23ba11a8, 0x2b53bda9, 0x22b15bda, 0x703aba9d, 0x72bbfbd0, 0x55210bd0, 0xf57baa95, 0x57015abd, 0x5701fabd, 0x5570bd7d, 0x42b5aaa9, 0x57f0a83d, 0xa52bd7f8, 
+	0x37b7b985, 0x717a19bc, 0x73ab5188, 0x73fab188, 0xa17b5bdf, 0x52bf1a94, 0x57b501a8, 0x52ba15a8, 0xb57fbd5a, 0xa17fbfd5, 0x7f01500a, 0xa150015a, 0x002bfd55, 0xaa03d555, 0xd7faaaaa, 0x57faaa00, 
+	0x212a1994, 0x32ab39d4, 0x3abf39d5, 0x71003b8d, 0x3aa2b9d5, 0xb502b95f, 0x215529ad, 0x03aab580, 0x2803a94b, 0xf5a010aa, 0x3fffabd5, 0x7faab5af, 0xfd6ba802, 0x14a155f5, 0x00001555, 0x00000000, 
+	0xc8c4e562, 0xdcac4675, 0xacac467f, 0xd484e6a2, 0xdec04427, 0x85ec0643, 0x8e84ae75, 0xc5fc462a, 0x4deaeea2, 0x8c004f61, 0x8540ef6b, 0x8ea84575, 0x8d6a8422, 0x8febc577, 0xcaf5c575, 0xd450ae2b, 
+	0x88ec56f6, 0xde8ee567, 0x884c5656, 0xde8c6f7e, 0xfcd6ea42, 0x8ac54425, 0xfcad6e02, 0xdfe84602, 0xadeafe57, 0xd4afefe2, 0xfc05ea7f, 0xfea84575, 0x0d42856b, 0x5c2aaea2, 0xaeaa8575, 0x0f55ea52, 
+	0xd84ee042, 0xa8cea56f, 0xa8ac656a, 0x5fcc5756, 0xddeeaa42, 0x94842f47, 0xaacae02f, 0xaadee02f, 0x94feaaf6, 0xad4a5407, 0x80afeaa5, 0xad54a557, 0x0857fea5, 0x5d57fea5, 0x8aa00f55, 0xaafaaf55, 
+	0xbdc46aa6, 0xbdc46aa4, 0xfdc457fe, 0x4bcc7556, 0x5ace0056, 0xd5c56aa4, 0x5ad46aaf, 0xaa8457fe, 0x5d4f5547, 0xa8af5542, 0x55eafffe, 0xd55eaaaa, 0xa8a550f6, 0x5aff55eb, 0x55555555, 0x00000000, 
+	0x232bb995, 0x723bb908, 0x773b9518, 0x7531bf98, 0x2a3b1a89, 0x75211a9f, 0x75310bd1, 0xa23b8159, 0x16b381fd, 0x7f710815, 0x5613dabd, 0x57510abd, 0xbeb79afa, 0xaf53a850, 0x0571a82b, 0xfe359429, 
+	0x37b1799d, 0x753bab9d, 0x23b5bb89, 0x231515b8, 0x217bba89, 0x22b151d0, 0x037bf958, 0xa21155bd, 0x52a115d0, 0xbf7ab80b, 0x55215aa9, 0x57f1ffa9, 0x557fb855, 0xaaa15aaa, 0x557abea9, 0x82a15ff5, 
+	0x23bf1188, 0x7301299d, 0x735b5194, 0x75395388, 0x2b02b9ad, 0x52b51594, 0x75295108, 0xf7bab5a8, 0xb502b94a, 0xa017a955, 0x2a150155, 0xf5515500, 0x282a1fd5, 0x0003fad5, 0x55529555, 0x557fd550, 
+	0x21153bdd, 0x335a119e, 0x231f519d, 0x729013d8, 0x3500395c, 0x35157b8d, 0x750b515d, 0x535aa1a8, 0xa155795e, 0xa155795f, 0x17d2abd5, 0x02955280, 0xbd57f805, 0x55555005, 0x7d555000, 0x00000000, 
+	0xcdc446f7, 0x8c8446f7, 0xdc484677, 0x8e84ee22, 0x5cc54427, 0xdce84562, 0xcd44ae61, 0xcaeac422, 0x0caeaea7, 0x8d455462, 0x0ca54ea3, 0x8eaa86f7, 0x9c428065, 0x94eb5ee3, 0xdc6bd463, 0x5c57de75, 
+	0x48cae656, 0xcadee6f7, 0xe8484625, 0xc85ec620, 0x5caef46a, 0x85c546a2, 0x0d4ae560, 0xd4afee7f, 0x08eaff47, 0xd4d6aea5, 0xfc54af42, 0xe855456b, 0x08400042, 0x94ff5ea7, 0x5eafad60, 0x85414a57, 
+	0x0acc6a56, 0x5e8c6f7e, 0xdfcae655, 0x855c4774, 0xa84d6a56, 0x80ac6aa5, 0x0fd442f5, 0x855ec255, 0x95eeaaa6, 0xfd4a542f, 0xfc05f42f, 0xad55457f, 0x50eaaaaf, 0x00ff54a0, 0x55f40aa5, 0x0aa55ff5, 
+	0xffcc602e, 0x80844206, 0x40ace205, 0xebdee754, 0x0bcef556, 0x55d46a05, 0x408547ff, 0xafac56be, 0xbd4ff540, 0xffd47ffe, 0x554af554, 0xaaaaeaaa, 0x50aeb5ea, 0x50af5554, 0x00000000, 0x00000000, 
+	0x723bb9a8, 0x77b11098, 0x57311a90, 0x0231b8b8, 0x7a3b59a9, 0x2b7bb809, 0x7521181f, 0xb75395a9, 0x2ab791d5, 0xb57b095f, 0x55711fd0, 0xaa35bdfb, 0x3ff7b8ff, 0x505218aa, 0xfd751855, 0x0a53a8a1, 
+	0x23b0119d, 0x61301b89, 0x771381bd, 0x27110ba9, 0x37ab159f, 0x521151a8, 0x203babda, 0x57011fa9, 0x53f51080, 0x2b57bdaa, 0xb57ab80b, 0x57f15aab, 0x15553daf, 0xaaab5bea, 0x157f0941, 0xaaf01feb, 
+	0x23b01158, 0x23150198, 0x77115158, 0x27bbabd9, 0x2b0151a8, 0x72baba9a, 0x77ababd0, 0x7f3f815a, 0xb501795f, 0x52abfa94, 0xf02bfd0a, 0xf57a9550, 0x7a82ba85, 0x2a82bd05, 0x00029555, 0x5557ad55, 
+	0x23bab598, 0xa3101518, 0x6310a11d, 0x2211ffb8, 0x530ab15c, 0x77bffba8, 0x6b01551d, 0xa350aba8, 0x2155515d, 0x03fd2bd5, 0x2b5555a8, 0xa015550a, 0x0154295e, 0x29557f85, 0x2aaaaaaa, 0x00000000, 
+	0x8dc44657, 0x884eee27, 0x8ced4662, 0x8caec422, 0xd4ca4567, 0xdd445462, 0x8ceac2e2, 0xdec00463, 0x5deeff47, 0x88454042, 0x08effef7, 0xdc568567, 0xa8c7ffe5, 0x1cae1456, 0x1c401457, 0x5ca52d47, 
+	0xe8d44674, 0xd4e84674, 0xc84aee77, 0xccad466b, 0xc80ee074, 0x80ed47e2, 0x8d45ef6a, 0xd4feae7f, 0xbcaea542, 0x8ad4556a, 0xd4afeaf7, 0xded7d6f7, 0xa8ae0006, 0x94af54a5, 0x5aeaaaff, 0xd5ea0af5, 
+	0xcadc6e2a, 0xad4ae6f7, 0x8e85e657, 0xc05ec6b7, 0x85d44255, 0xd48546a0, 0x85e84257, 0x8e804a75, 0xe8ad6a05, 0xa80fe057, 0x80afeaa0, 0xad55407f, 0x50aeabea, 0x5ad6aaaf, 0x5feaaaaf, 0x0affaaf5, 
+	0xfd4866a0, 0xc05ce756, 0xc55c463e, 0xcaad467a, 0x800c5754, 0xe94ae57f, 0xeaade57a, 0x8555ef7f, 0x41486b54, 0xf5feeb4a, 0x000af416, 0xad55f401, 0xb5fc20aa, 0x528557d5, 0xaaaaaaaa, 0x00000000, 
+	0x737bb995, 0x573b1a9d, 0x03711958, 0x3533bda9, 0x703ab995, 0x1703b9fd, 0x357b1a8b, 0x52539081, 0x7157bbdd, 0x3502b9d5, 0x7aa13dad, 0xab5718aa, 0x715535de, 0x3ad71085, 0x7802194a, 0x3d431fc0, 
+	0x233bf909, 0x23511bd9, 0xf73ba959, 0x7f33dbd0, 0x23b51595, 0x0353a958, 0x2b7ba958, 0x7f5395f8, 0x53fa1094, 0x215510bd, 0x552b5a8b, 0xfa03a955, 0xb0003a8f, 0x214010a8, 0x7aafbfd5, 0x2aaf1fd7, 
+	0x2211bf98, 0xe33a9018, 0x43359518, 0x577b95a9, 0x771501bc, 0x22baba95, 0xf7a10bf8, 0x57510bf8, 0x77a97a9f, 0xf52abd0a, 0x2a15015f, 0x5553fd55, 0x2bfeb580, 0xf00a155f, 0x55a500aa, 0x505500aa, 
+	0x77395518, 0xa211abbd, 0xa2395ab8, 0xa73bd515, 0x22bbff95, 0xe35bffbd, 0x5715001a, 0xf7f1ffa9, 0x2010529d, 0x02baaabd, 0xaa15a00b, 0x6ab5aaab, 0xf014a10a, 0x7faaf5a8, 0xa00aabff, 0x00000000, 
+	0xc8c4e427, 0x8caeee76, 0x884ea462, 0xdced4427, 0xd4cae567, 0xdd4ea474, 0xdceaea42, 0xdd440476, 0x55c456af, 0xa8ed6aa6, 0x08ea5407, 0x94ca0042, 0xbdc56bea, 0x50cf7fef, 0x1d4f7fc7, 0x1ac57ac2, 
+	0xcd4c476a, 0xcac046f7, 0xdec04477, 0x8caeae67, 0xcadee56a, 0xaded6ea2, 0x0defef42, 0xa8efeae2, 0xa8ac57f4, 0x548407ea, 0xfcafea56, 0x5d45542f, 0xfd5ef554, 0x28aeabea, 0x55c02aaf, 0xfdea0054, 
+	0x84acef77, 0x8e85e66a, 0x84ae866b, 0xded40477, 0x85fc4756, 0xca8546a2, 0xad4aea7f, 0x0d405477, 0xc0a86a05, 0x805eaf56, 0xd54af402, 0xad405f42, 0x55ad6b54, 0xffd42aaf, 0xa8055554, 0xbfeaaaaf, 
+	0xcad4c775, 0xcfe8ee37, 0x8ea84423, 0xcd40ae77, 0xca5d462a, 0xc55ed652, 0xdeaac575, 0xe8554f75, 0x40085615, 0xff5efe15, 0xc000542a, 0xd400057f, 0xf55d6a1e, 0x2aa857aa, 0xffffff5f, 0x00000000, 
+	0x7213b9d0, 0x2b351995, 0x37a39b89, 0x212391da, 0x753abb88, 0x32b1798a, 0x37a11095, 0x12a139d5, 0x73fab18a, 0x2bab518a, 0x7017a908, 0x35a2b9d5, 0x71002b9c, 0x70bf510d, 0x7bfe11d4, 0x3faf51de, 
+	0x2213909a, 0x75311595, 0x523b1d09, 0xa1739081, 0x23f15b89, 0x5353a958, 0x2b53a90a, 0x3f52b9fd, 0x23aaba9d, 0x2b501008, 0xb503fa9e, 0x7aab01d5, 0x21002b8a, 0x7bfff1fc, 0x7aaab5ad, 0x3aaf01d5, 
+	0xe37b9ab8, 0x037b90b8, 0x7f211815, 0x022b9bd0, 0xa2b1abd0, 0xa2b15abd, 0x570115aa, 0xff53a95f, 0x7529501d, 0xa17aabd5, 0xa017a955, 0xab5501ff, 0x52bd7abc, 0xf500015f, 0x2bffffad, 0x505f5aaa, 
+	0x6b315ab8, 0xeb719015, 0xf6b11ff9, 0xaf71905b, 0xa7b0bfa9, 0xff2b801a, 0x07010abd, 0x55715aab, 0x4210aab8, 0x6a15aa1f, 0xaa15555a, 0xff5000b5, 0xa015f500, 0xff5aaa0a, 0xf5555555, 0x00000000, 
+	0x8cde4642, 0xdcc45462, 0xdcae4426, 0x8dc46fe7, 0xadc4f6f6, 0x88aee56a, 0xd4846fe7, 0xfdc47ea6, 0xd5d46f56, 0xd0d46a54, 0x00de6aaf, 0x5acea006, 0x50ac57af, 0x694c2a0f, 0x01c40282, 0x15ca7ffe, 
+	0x8cd44477, 0xdced4657, 0xdd4456e2, 0xdcc2eae7, 0x485eef6a, 0xaded4742, 0x884a456a, 0x5deea547, 0x548047f5, 0xa80ea556, 0x94ad6a55, 0x5d4a5542, 0xffd4f57d, 0x00a86abe, 0x55aea005, 0x7d5e5005, 
+	0x8c54ee75, 0x8d454477, 0xdceaeea2, 0x9c405462, 0x8e804422, 0xd4ad46a2, 0x8d4afe57, 0xdd455475, 0x5ea842f5, 0xd54afe02, 0xfd40556a, 0xd5eaaa56, 0xa00aea14, 0xebfc07aa, 0x555feb54, 0xaa855505, 
+	0x8c004e72, 0x8c40ae63, 0xdeeaae62, 0xdce00e62, 0xca55ee7a, 0x8eaac577, 0xaca0ae52, 0xc857c061, 0xafffc755, 0xd400a42a, 0x85554a57, 0xfc000057, 0xaf5ad755, 0xaaaaaf55, 0x55554015, 0x00000000, 
+	0x373bbbd8, 0x23b2b99d, 0x32b1395d, 0x23a13988, 0x2b3abb88, 0x2315395d, 0x7b52b9a8, 0x3017bbdd, 0xa315011d, 0x23bfa194, 0x72bfa188, 0x2baab1dd, 0x6128011d, 0x6114b51c, 0xf35ff15c, 0x7baff15c, 
+	0x7a311a98, 0x72b3bd95, 0x37a111da, 0x352111df, 0x2b35ba95, 0x2b7bab8a, 0x217babd8, 0x2b52b95d, 0x612bfa9a, 0xa3abfbd0, 0x77aaba9f, 0x2bff0180, 0x6128010a, 0xa3aaaba8, 0x7500515f, 0x75aaa1ad, 
+	0x253395d1, 0x522b9bd0, 0x3f7b180b, 0x17f3bd80, 0xa0315a95, 0xa03b5815, 0x02b51a95, 0x7a03bd5f, 0x5751ffa9, 0xaa12815a, 0x02bfaa95, 0xb555015f, 0x0215ff58, 0xf51557d0, 0x02bd7ffd, 0x7aaaabff, 
+	0xa0339fd1, 0xf5711801, 0xbf739495, 0xbff3b8fa, 0x022b9ffb, 0xff7ba801, 0x002bbd55, 0x7ff01aaa, 0x57515f5a, 0xaa150abf, 0xaa515555, 0xaaa155fa, 0xf4380551, 0xff500550, 0x56bfeaa9, 0x00000000, 
+	0x8deeee76, 0x48cee567, 0xdd4e46a6, 0x08ce56e2, 0x80d4462f, 0xd484e7e2, 0x80ca4747, 0x5d4ee056, 0xed5c4257, 0x85fc4255, 0x00ac4205, 0x55d46a05, 0x455ca755, 0xaaa84755, 0xa0a8420a, 0xa1486000, 
+	0x8ac44567, 0xdcd6ee57, 0x8dc47ef6, 0xddc6ea42, 0xc84aee02, 0x884ae56a, 0x0acfe56a, 0x5d4ea542, 0xdea847f7, 0xd54aea57, 0xe80ea556, 0x5fd456aa, 0x855aef7a, 0x555ed755, 0xea80f6be, 0x550fe17c, 
+	0xdcea4e77, 0x88efee57, 0xdcc2eae7, 0xbcc40067, 0x8e854422, 0xdc054562, 0xfcaeafe2, 0x8ac07ea6, 0xc055ef6b, 0x854aae02, 0xfd40556a, 0xfd4a5542, 0x0555ea50, 0xafaafe15, 0x5554a555, 0xebfeaa0a, 
+	0xdc405462, 0xdceaaef7, 0xa8eeaef7, 0x9cea5ea7, 0xc8428477, 0xded7c062, 0x8aeaaea7, 0x88540057, 0x8ff5eff7, 0xdfeaad75, 0xd5400542, 0xa855556a, 0xea50aeb5, 0xaa55feab, 0x54294001, 0x00000000, 
+	0x2b311098, 0x77b11098, 0x32113bdd, 0x73ab1188, 0x77b15b95, 0xa32bbd1d, 0x753aba9d, 0x23bfab9d, 0xf7115518, 0x7715abbd, 0x77bfab94, 0x77bffb8a, 0x6b2bd53d, 0x43294109, 0x571afa1d, 0x6b1ff51d, 
+	0x21711bd8, 0x72b111d5, 0x32b51188, 0x23ab11dd, 0x2b7bbd1d, 0x21210b8a, 0x212b5b8a, 0x212abbdd, 0xe17baa95, 0xf7ababf8, 0xa3ab55a8, 0x5355515d, 0xff795550, 0x4350aa1d, 0xa515550a, 0x2015f508, 
+	0x57a3990a, 0x2171108b, 0x35531a88, 0x53f511dd, 0xa0315a95, 0xa1701a95, 0x03f51a95, 0xb503f95d, 0x403abd50, 0xaa12955a, 0x017fabd5, 0xa155015f, 0x02b5afab, 0x42bfaff8, 0x55500015, 0x55000015, 
+	0x3f53180a, 0x2b5315df, 0x2aa3b880, 0x2143b9e8, 0xaa2b1d55, 0xbff3a8ab, 0xa003bdff, 0x7aa01080, 0xaf53d5fa, 0x557abd55, 0xbff500aa, 0x00015005, 0x5f7f8550, 0xfeb5ffff, 0x557fffff, 0x00000000, 
+	0x8acee427, 0xadc44656, 0xc8ac6426, 0xadcee2f6, 0xcd4d467f, 0xd4d4e576, 0xd484e025, 0xe80c6f56, 0xd40aee20, 0xc05ec257, 0x855c4252, 0xd55c422a, 0xcf5ac617, 0x455fc615, 0xeaa8e52a, 0x450aef28, 
+	0x94c44067, 0xdc846f47, 0xa8cea6a6, 0x5dc46a56, 0x5cfeea42, 0x884aea6a, 0x8ad44256, 0x5fcea56a, 0xdead4577, 0xd54aea57, 0xad5efe02, 0x4aad47ff, 0x840bee03, 0x5e0aae01, 0x8500ea29, 0x02ade028, 
+	0x9cc6aee2, 0xddee5465, 0x1c86e042, 0x58ec2547, 0xdd454567, 0xd486aea7, 0xfcaeaf42, 0x5fcf402f, 0x8afead62, 0x80ffea57, 0xfd405402, 0xd54aff54, 0xd450042b, 0x0a55fe01, 0xfebfea00, 0xeb54aa00, 
+	0x9cc7fee2, 0x88ef4047, 0x08c42ae6, 0x1dee5546, 0x8ac7fc62, 0xdd45686a, 0x80c2ffe7, 0x08ae0056, 0x94f55e57, 0xa856a86b, 0x94aa5ff5, 0xaaaeaaaf, 0x0af55ea1, 0xad7ffc2a, 0xfeaa8002, 0x00000000, 
+	0x77b11189, 0x3713bd98, 0x23b51189, 0x72bbbb88, 0x75310b89, 0x0335bf9d, 0x77115158, 0xa3381298, 0x2f3bf815, 0xf751aa90, 0xf715aba9, 0xf7100159, 0xea3bd551, 0x57795fb5, 0xa53a82bd, 0x5710aa10, 
+	0x212111d8, 0x73a1118a, 0x2b12b908, 0x73abb1d8, 0x2b7bbdbd, 0x2b2bbd09, 0x03011509, 0x70117a9d, 0xf5715a81, 0xf52ba950, 0xa53f815a, 0x57015509, 0xd6129401, 0x56100aba, 0x6a15aa15, 0x0215ffab, 
+	0x3503b980, 0x37b53985, 0x23ab109f, 0x73fa118a, 0xa17b5bdf, 0x52b51580, 0x2b5510bd, 0x7517fbdd, 0xbf52bdaa, 0xf52bfa80, 0xa17faa95, 0x2b55abfd, 0xfe178050, 0x56b5aaab, 0x02abffff, 0x02aa82a9, 
+	0x35031bc9, 0x350311ca, 0x13ff39df, 0x31553bdc, 0xb5f2b9d5, 0x3aa129fd, 0xf157b5df, 0x17afb58a, 0x5a5290aa, 0x5552bd55, 0x7fa50bd5, 0x5000295f, 0x5403d055, 0xbeab5feb, 0x80015555, 0x00000000, 
+	0xd4ceef67, 0x80c4e427, 0xc0cae67e, 0x85cae67e, 0x5ce846a2, 0xde84a6f7, 0xde84ef74, 0xd4ad467a, 0xdc54ae75, 0x8ead4422, 0xc55ed67f, 0xeffca652, 0xcfebc423, 0xcaf5c577, 0xd428ae21, 0xd428ae21, 
+	0xa8c447e7, 0x88ec5656, 0x8aceea7e, 0x5d4c4256, 0x5ce842e2, 0x48feef42, 0xe85eef6a, 0xfc0d6f6a, 0xdeafeea2, 0x85eafe57, 0x8ffed6a2, 0x4afd47f5, 0xdea0aea3, 0x84a0aea1, 0xd42ad42b, 0xc550fe2b, 
+	0x88ae4567, 0xdacef424, 0xd48e42f6, 0xd5cef6af, 0x8ac542e5, 0xa8d47ea7, 0x480ea56a, 0x55c547ff, 0x94feaae2, 0xa8540542, 0xfe85402f, 0x5ffed7f5, 0xa8555402, 0xe8555f42, 0xd555542a, 0x4000057f, 
+	0x5deef406, 0x948e6af6, 0xfdce57ef, 0x0bcef7ef, 0x584f5407, 0x5acf556f, 0xfdd6f547, 0xaa8e5556, 0xbca41407, 0x5d405056, 0x55eaaaff, 0xffd42aaf, 0x0aff5ae0, 0xfd429542, 0x55555541, 0x00000000, 
+	0x75311bd8, 0x75311a98, 0x233bf91d, 0x233a9109, 0x21711a9d, 0x7f315bd0, 0x2171bd1a, 0x573baa99, 0x2a351801, 0xaa315815, 0xf535bd29, 0xff359579, 0xfeb3adf0, 0xaf7bad50, 0x4a30bc3d, 0xea308029, 
+	0x73f1118a, 0x23b0119d, 0x231011a8, 0x23b5b598, 0x2b53a9a8, 0x2b53a908, 0x03511509, 0x03795158, 0xb5715a95, 0xa2a10bd5, 0xaa3f955a, 0x572955bf, 0xff5795ff, 0x55701ea9, 0x4a2b8550, 0xea015ff0, 
+	0x717a1188, 0x3352b994, 0x712bfb9c, 0x77bab1a8, 0x37a15180, 0x52b510bc, 0x7a1515a8, 0x61297a9d, 0xb557bdaa, 0x017fbfd5, 0x552bfd00, 0x6b55ab5d, 0x0aa15aaa, 0xa82bfd55, 0xaaa15ff5, 0xd7f5affa, 
+	0x33ff118a, 0x71503bdc, 0x73d2b1dd, 0x72baa19d, 0x7157b58d, 0x71552908, 0xf3ffa180, 0xa3aaab8a, 0x5002b80a, 0x155529ff, 0x7faaabd5, 0x550017d5, 0x15f528a5, 0xbfeabfd7, 0x55555000, 0x00000000, 
+	0x884eee76, 0x8d4eee27, 0xcd4d4676, 0xcd4ec76a, 0xac8456e2, 0x8caeae60, 0xdc4ac6a2, 0xecaac652, 0xdc540477, 0x8eae8427, 0xdeffeef2, 0xcfea8472, 0x9eeaad67, 0x94e14a43, 0xaca00ea3, 0x84500e53, 
+	0x8dc447e2, 0x48d46e25, 0xdd4c4274, 0xac0c4756, 0x80c54567, 0xa8eaef6a, 0xe84aef6a, 0xad4aef6b, 0xfcaeafe2, 0xadeafe57, 0x8afe86a2, 0xcafd4575, 0x80eaaae1, 0x5d6aad60, 0xad414a57, 0x8555547a, 
+	0xa8d4656f, 0x8a8ee7e0, 0xa85c642a, 0xca8eea2a, 0xa8ed6a56, 0xa8aeeaa5, 0xadfc5602, 0x5ead46b4, 0xa8eaffe2, 0xfd4a5407, 0xa854a556, 0x54aad6ab, 0xa8a55542, 0x0aeaa82f, 0xfd57e82a, 0x8050007f, 
+	0xd5cee02e, 0xa88e42a4, 0x4bcc6b56, 0x4084e2aa, 0x50de6aaf, 0x50d442af, 0xffdee002, 0xad0ef556, 0xa94e0147, 0xfd4a5556, 0x5fd402af, 0xfffc2fff, 0x00aebafe, 0xfd543d42, 0x28002aaf, 0x00000000, 
+	0x2b31159d, 0x57311a98, 0x03310b9d, 0x22111a99, 0x35211bda, 0x37f11a9f, 0x037b95a9, 0x023ba95a, 0x552115d5, 0xa0351800, 0x00351801, 0xaa35bd50, 0xbff7b8ff, 0x557fb8a5, 0x5eb79afa, 0xfeb79feb, 
+	0x735111d8, 0x773ba91d, 0x232910b8, 0x03315a99, 0x52b1518a, 0x22bb5bda, 0x2a3bf81a, 0x572b950b, 0x017a1bd5, 0x502b095a, 0xaa1795aa, 0x57f15aa9, 0x7af515d5, 0x1552b805, 0xaaa3d0f5, 0xaaa3daf0, 
+	0x73153bd8, 0x233aba98, 0x77bbfb9d, 0x7710b5bd, 0x21517908, 0x72babbd5, 0xf2b015a8, 0x2a39551d, 0xa152ba8a, 0xa2abf955, 0xb552a95f, 0x42bfaa95, 0x0140380f, 0x50a0155f, 0xaaab5aaa, 0xaffaaaaa, 
+	0x23bfab9d, 0x23bab598, 0x75115298, 0x77baab98, 0x751551bc, 0x75155108, 0xf2baaba8, 0xa2baabd0, 0xf1557bde, 0xa155515e, 0xf500015d, 0xf550001f, 0x155f514a, 0xabeaabd5, 0xfaaa50aa, 0x00000000, 
+	0x884eee27, 0x8cfc466b, 0xccd44477, 0x8e84ee27, 0xdcd6ef6f, 0xdceaeea7, 0x8cafee77, 0x8cfeae62, 0x884f4a42, 0x5cd6aea7, 0xdca54065, 0xdc554565, 0x08ea0042, 0x88ea14f7, 0x9c401443, 0xdca78542, 
+	0xadc4e562, 0xc84d4675, 0x8cac4577, 0x8c54c620, 0xadc406a7, 0x8aca4562, 0x8fed46a2, 0xcae85477, 0xa84ff457, 0x94d42d6a, 0x8aead425, 0xad405457, 0x0ac02aea, 0x80d6aad7, 0x5fefaae0, 0x0aeaa87f, 
+	0xca8ee6a5, 0xd4ace742, 0x8e8ae657, 0xcfe8e652, 0xa85c6a2e, 0x85fc6a57, 0x805eea57, 0x5ead46a0, 0x80ac2a54, 0xfd4a4002, 0x80afeaa0, 0xc05feaa2, 0x15effffe, 0x00affffe, 0xad540005, 0x94000055, 
+	0xaa8ee6aa, 0xe80c4755, 0xafdeef7a, 0xdebce615, 0xffdee2af, 0x4bd44205, 0x05fc42aa, 0x4aa84250, 0xa0856aaa, 0xd00fe000, 0xaaad6aaa, 0xc000a57f, 0xabc07aad, 0x555f5554, 0x505fffaf, 0x00000000, 
+	0x77b1118b, 0x723bb958, 0x7a311959, 0xa23bb8bd, 0x73f111d5, 0x2171158b, 0xf535195a, 0xab711d01, 0x3552b9d5, 0x52ab1a8a, 0x3f53594b, 0x3f57b8aa, 0x3fd7108a, 0x78035bca, 0x5057b8af, 0x15571df5, 
+	0x53301b89, 0x773ba91d, 0x6b315bd9, 0x22b395f9, 0x521291a8, 0xa3512958, 0xa2b101fd, 0xf5211d01, 0x7a0151ad, 0x3552b80a, 0x2ab515aa, 0x002b0955, 0x2bff51d4, 0x5142b80a, 0x3d57bd55, 0x005515ff, 
+	0x7239011d, 0xa330ba99, 0xe33a9018, 0xf73bd518, 0x2b152908, 0xf71501a8, 0xf7b50bf8, 0x2a13d509, 0x35283a9e, 0x52abfa95, 0x2a15015f, 0xaa0150ab, 0x2bd57bd4, 0x1555514a, 0x2aaab5fe, 0x0002bd57, 
+	0x77bbfa98, 0x6310b518, 0x433bd798, 0x6211ffbd, 0x6b100388, 0x77bffa90, 0x5715aab8, 0x5710001a, 0x7f1ff51c, 0x2015551e, 0xa2bd5295, 0xeb55aa0b, 0x750af15e, 0x2bd57fad, 0xfaaaabff, 0x00000000, 
+	0xcdc446f7, 0x8deeee6b, 0xdc4fee62, 0x8ceac6f7, 0xddeeea42, 0xdceaef42, 0x88eeaea7, 0xdc4a5467, 0xfdc42fe5, 0x94ca542f, 0xdd440042, 0x9ca40042, 0x0a8e7fc7, 0xb8ef5546, 0xa8d6aaaf, 0x58ea28f6, 
+	0xcacae6f7, 0xdecaee27, 0x4dec56e3, 0xc845ee77, 0x85c5e6a5, 0xaded6e02, 0x84854562, 0xded6d477, 0xfde86a06, 0x8ad4556a, 0x8ad6fea5, 0x5de55457, 0x15c57ffe, 0xa9440145, 0x5ad6aaaf, 0xa856a807, 
+	0xcd5eee22, 0xed4aee75, 0x8fe84652, 0x84afc675, 0x805c4257, 0x85fc42f5, 0x85ead657, 0x5c554420, 0x800d6555, 0xe80a402f, 0xd54af402, 0xd4aa5f42, 0x014fe14a, 0xaa8557d6, 0xbfc02aaf, 0xfd40156a, 
+	0x84a8e62a, 0xcafcef75, 0xac00ee21, 0xcd55ee72, 0xafd4ea2a, 0xd40aef7f, 0xd40ad62a, 0xdeaac070, 0x050d6f00, 0x8000e02a, 0x4aaafeb5, 0xc0005f57, 0xab487faa, 0x57d54155, 0xf554a00a, 0x00000000, 
+	0x723bb9a8, 0x723bb9a8, 0x17351981, 0x22b3b895, 0x37b5118a, 0x23a111d5, 0x217b158a, 0x01729bdd, 0x73aa118a, 0x717fb09e, 0x35a129ad, 0x3aa2b9d5, 0x7bff5185, 0xb1557b8e, 0x714a39fc, 0x1007ba85, 
+	0x631291a8, 0x523bb818, 0x7533a9a9, 0x57b309f9, 0x72b15b8b, 0x203b5bda, 0x035291fd, 0xf02b180b, 0xb7bfa1a8, 0x2b50101d, 0x7ab515a8, 0x52ab5bd5, 0x215f515c, 0x21557a8a, 0x7aaab585, 0x50a03d5e, 
+	0xa23b951d, 0x7713d0b8, 0x2f31581a, 0x7f7b90bd, 0xf710151d, 0x7535bf80, 0xf535bf80, 0x2a1795f8, 0x77abfabd, 0x57abfabd, 0xa017a815, 0xab551555, 0x53fd7abc, 0xa155550a, 0x5555500a, 0xabf415ff, 
+	0x573b8159, 0x5731aab8, 0x6a31a810, 0xaa310aa9, 0xa7115509, 0xe2bbaabd, 0xa535a950, 0x02010abd, 0x7f155514, 0xa5295500, 0x42baaabd, 0xff550ab5, 0xf500a01f, 0x6bffebfd, 0xa00aabff, 0x00000000, 
+	0x8c84466a, 0x88ec6ea7, 0xdcc56e42, 0xdcc54427, 0x8dec5656, 0xdd4ef476, 0x88ed6a47, 0x08c56ae2, 0xd5d46f42, 0x808456a5, 0x58fef56f, 0x5ace0006, 0xf5de6aaa, 0xa9d47554, 0x29c5754a, 0x50d470ae, 
+	0x8cac46a2, 0x8d44a462, 0xdec54462, 0x48c6d462, 0xcacae560, 0x8fc4a425, 0xacaed6a7, 0xdd440565, 0xfd4ae556, 0x4a84a557, 0x00d457ea, 0x5fc556af, 0x00a86a0a, 0xd00ea005, 0x50aea00a, 0xbd5e0142, 
+	0xdc54ee22, 0x8c04ae63, 0x8cfe8662, 0x8aefeef7, 0xd404ae75, 0x8ae84077, 0x8ad40422, 0x0840546b, 0xea85e57f, 0x4aad4255, 0xfc054057, 0xfd405542, 0xa00aea14, 0xaaad57ff, 0xaaad7ffe, 0xffd57fea, 
+	0xd44ac6a3, 0x8efd4477, 0x8c55ee77, 0x8c554a62, 0xe855ee20, 0xd455ee2a, 0x85ea86a2, 0x0c000475, 0x8555ef7f, 0x8555ea52, 0x54aaaf55, 0xfc00007f, 0xeabd420a, 0x55554015, 0xffffff55, 0x00000000, 
+	0x373b1bd8, 0x232bb995, 0x32131a88, 0x72b1389f, 0x213a11d8, 0xa315395d, 0x7153b588, 0x21035994, 0xf3015108, 0x72bab09f, 0x72953588, 0x3001790d, 0x7515529d, 0x23aaa18a, 0x715f510d, 0x35aa018a, 
+	0x237b9090, 0x35211958, 0x1717b9da, 0x3a2b19d5, 0x235101a8, 0x72b5ba9d, 0x52b2b8bd, 0x2153595d, 0xa3b550bd, 0x570150bd, 0x2b5515a8, 0x7ab551fd, 0x521af01d, 0x7500015a, 0x7abff0bc, 0xf154290f, 
+	0xa23b95bd, 0x577b90bd, 0xab711a81, 0x2a131d5a, 0x573a951d, 0xf5210bd0, 0xa03fb80b, 0x7ff101fd, 0xf7b5aab8, 0x7f2a950a, 0xf501500b, 0xb555155f, 0x021fffa9, 0xf7f82aa8, 0xab5ffaa8, 0xabfff5aa, 
+	0x577195a9, 0x022b9aa9, 0xaa211801, 0xbf711d55, 0x02129fab, 0xa0315ff9, 0xaa1295fa, 0x00210955, 0xea115415, 0xaf515ffa, 0x7ff00abf, 0xa5501555, 0xaa3d4015, 0x42bd57fd, 0x4015557d, 0x00000000, 
+	0x8d4eee76, 0xc8c442e2, 0x9cd46457, 0xddc46a6f, 0xadeca657, 0xd48ee2f6, 0xa8846a56, 0xbdc47406, 0xfd486f7e, 0xd5ec56aa, 0x00845740, 0x55cea2ae, 0xeb484700, 0xffdc7554, 0x415c6000, 0xa14c7fad, 
+	0x8cd44427, 0x884eae62, 0x88c42ef6, 0x88eeaf47, 0x8ac046a7, 0x5caed657, 0x5caefe07, 0x58efe042, 0xd40aef7f, 0xfc0ae557, 0x0ad456aa, 0x55c56aaf, 0xeabc5614, 0xd7d4f57d, 0x000aeb54, 0xffd45500, 
+	0x8c54ea67, 0x8d440462, 0xdceafe42, 0x9ceffe42, 0x5c54ae75, 0x8aeaefe2, 0xded40565, 0x5d4f4042, 0xae80a420, 0x805eaf42, 0xd40a542f, 0xd5eaffea, 0x455aea00, 0xaaaaaf55, 0x000aa555, 0xffd557fe, 
+	0x8c054477, 0x8c540e62, 0xdce00e43, 0x9c42d462, 0xc8400e75, 0x4d405e6b, 0x88568562, 0x0d455457, 0xdeaa86a1, 0x8a554f57, 0xd4aaaa57, 0x5eaaafeb, 0xd6bfc2a0, 0x55554a15, 0x55555555, 0x00000000, 
+};
@@ -11,3 +11,7 @@
 
 extern uint32_t premodulated_table[918];
 
+// 64 colors for C3_FB_EXT64, same phases as premodulated_table
+#define PREMOD_EXT_SIZE 64
+extern const uint32_t premodulated_ext_table[PREMOD_ENTRIES_WITH_SPILL*PREMOD_EXT_SIZE];
+
@@ -0,0 +1,190 @@
+/**
+ * @file command_ring.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Lock-free ring of drawing commands from loop() or network code to the frame callback
+ * @version 0.1.0
+ * @date 2023-03-26
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+
+// --- Includes ---
+#include "command_ring.h"
+#include "video_broadcast.h"
+#include "3d.h"
+
+// --- Defines ---
+#if (C3_CMD_RING & (C3_CMD_RING-1)) != 0 || C3_CMD_RING > 32768
+#error "C3_CMD_RING has to be a power of two up to 32768"
+#endif
+#define RING_MASK (C3_CMD_RING-1)
+
+/** @brief Keeps the compiler from moving memory accesses across, the entry is written before the index */
+#define RING_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+// --- Private Vars ---
+static c3Cmd_t ring[C3_CMD_RING];
+/** @brief Next entry to write, only written by the producer */
+static volatile uint16_t head;
+/** @brief Oldest entry not free yet, only written by the consumer */
+static volatile uint16_t tail;
+/** @brief Entries before this were drawn onto lastFrame, the ones from tail on still have to go onto the other frame */
+static uint16_t applied;
+static uint8_t *lastFrame;
+
+// --- Private Functions ---
+/**
+ * @brief Runs one command on the pinned frame
+ *
+ * @param again The command was drawn onto the other frame already
+ */
+LOCAL void runCmd( const c3Cmd_t *c, uint8_t again ){
+	switch(c->type){
+		case C3_CMD_CLEAR:
+			video_broadcast_clear_frame();
+			break;
+		case C3_CMD_PIXEL:
+			video_broadcast_tack_pixel(c->x0, c->y0, c->color);
+			break;
+		case C3_CMD_SPAN:
+			video_broadcast_tack_span(c->x0, c->x1, c->y0, c->color);
+			break;
+		case C3_CMD_RECT: {
+			int y0 = (c->y0 < c->y1)?c->y0:c->y1;
+			int y1 = (c->y0 < c->y1)?c->y1:c->y0;
+			for(int y = y0; y <= y1; y++) video_broadcast_tack_span(c->x0, c->x1, y, c->color);
+			break;
+		}
+		case C3_CMD_LINE:
+			CNFGColor(c->color);
+			CNFGTackSegment(c->x0, c->y0, c->x1, c->y1);
+			break;
+		case C3_CMD_TEXT:
+			CNFGColor(c->color);
+			CNFGPenX = c->x0;
+			CNFGPenY = c->y0;
+			CNFGDrawText((const char*)c->data, c->arg);
+			break;
+		case C3_CMD_BLIT:
+			c3Blit((const c3Bitmap_t*)c->data, c->x0, c->y0, c->arg);
+			break;
+		case C3_CMD_CALL:
+			if(!again) c->fn((void*)c->data);
+			break;
+		case C3_CMD_PRESENT:
+			if(!again) video_broadcast_present();
+			break;
+	}
+}
+
+LOCAL uint8_t push( uint8_t type, uint8_t color, uint8_t arg, int16_t x0, int16_t y0, int16_t x1, int16_t y1, const void *data ){
+	c3Cmd_t c;
+	c.type = type;
+	c.color = color;
+	c.arg = arg;
+	c.reserved = 0;
+	c.x0 = x0;
+	c.y0 = y0;
+	c.x1 = x1;
+	c.y1 = y1;
+	c.data = data;
+	c.fn = NULL;
+	return c3CmdPush(&c);
+}
+
+// --- Public Functions ---
+uint8_t c3CmdPush( const c3Cmd_t *cmd ){
+	uint16_t h = head;
+	if((uint16_t)(h - tail) >= C3_CMD_RING) return 0;
+	ring[h & RING_MASK] = *cmd;
+	RING_BARRIER();
+	head = h + 1;
+	return 1;
+}
+
+uint16_t c3CmdSpace(){
+	return C3_CMD_RING - (uint16_t)(head - tail);
+}
+
+uint8_t c3CmdClear(){
+	return push(C3_CMD_CLEAR, 0, 0, 0, 0, 0, 0, NULL);
+}
+
+uint8_t c3CmdPixel( int16_t x, int16_t y, uint8_t color ){
+	return push(C3_CMD_PIXEL, color, 0, x, y, x, y, NULL);
+}
+
+uint8_t c3CmdSpan( int16_t x0, int16_t x1, int16_t y, uint8_t color ){
+	return push(C3_CMD_SPAN, color, 0, x0, y, x1, y, NULL);
+}
+
+uint8_t c3CmdRect( int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color ){
+	return push(C3_CMD_RECT, color, 0, x0, y0, x1, y1, NULL);
+}
+
+uint8_t c3CmdLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color ){
+	return push(C3_CMD_LINE, color, 0, x0, y0, x1, y1, NULL);
+}
+
+uint8_t c3CmdText( int16_t x, int16_t y, const char *text, uint8_t scale, uint8_t color ){
+	return push(C3_CMD_TEXT, color, scale, x, y, x, y, text);
+}
+
+uint8_t c3CmdBlit( int16_t x, int16_t y, const c3Bitmap_t *bmp, uint8_t flags ){
+	return push(C3_CMD_BLIT, 0, flags, x, y, x, y, bmp);
+}
+
+uint8_t c3CmdCall( c3CmdFunc_t fn, void *arg ){
+	c3Cmd_t c;
+	ets_memset(&c, 0, sizeof(c));
+	c.type = C3_CMD_CALL;
+	c.data = arg;
+	c.fn = fn;
+	return c3CmdPush(&c);
+}
+
+uint8_t c3CmdPresent(){
+	return push(C3_CMD_PRESENT, 0, 0, 0, 0, 0, 0, NULL);
+}
+
+int c3CmdDrain(){
+	// The back buffer belongs to the next frame already
+	if(video_broadcast_present_pending()) return 0;
+	uint16_t end = head;
+	RING_BARRIER();
+
+	// One frame for all of it, even if the frame number changes meanwhile
+	uint8_t *frame = video_broadcast_get_frame();
+	video_broadcast_pin_frame(frame);
+	int penX = CNFGPenX;
+	int penY = CNFGPenY;
+	uint8_t color = CNFGLastColor;
+
+	// Catch this frame up with what went onto the other one
+	if(frame != lastFrame){
+		for(uint16_t i = tail; i != applied; i++) runCmd(&ring[i & RING_MASK], 1);
+		RING_BARRIER();
+		tail = applied;
+		lastFrame = frame;
+	}
+	int done = 0;
+	while(applied != end){
+		const c3Cmd_t *c = &ring[applied & RING_MASK];
+		runCmd(c, 0);
+		applied++;
+		done++;
+		if(c->type == C3_CMD_PRESENT) break;
+	}
+
+	CNFGPenX = penX;
+	CNFGPenY = penY;
+	CNFGColor(color);
+	video_broadcast_pin_frame(NULL);
+	// Only one image, nothing to catch up
+	if(video_broadcast_get_mode() == C3_FB_STRIP || frame == video_broadcast_get_sent_frame()){
+		RING_BARRIER();
+		tail = applied;
+	}
+	return done;
+}
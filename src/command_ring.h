@@ -0,0 +1,100 @@
+/**
+ * @file command_ring.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Lock-free ring of drawing commands from loop() or network code to the frame callback
+ * @version 0.1.0
+ * @date 2023-03-26
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+#ifndef ESP8266CHANNEL3COMMANDRING_H
+#define ESP8266CHANNEL3COMMANDRING_H
+
+// --- Includes ---
+#include <c_types.h>
+#include "common.h"
+#include "blit.h"
+
+// --- Defines ---
+#ifndef C3_CMD_RING
+/** @brief Commands the ring holds, a power of two */
+#define C3_CMD_RING 64
+#endif
+
+/*
+	One producer (e.g. loop() or a network callback, only one of them) pushes commands, the
+	frame timer drains them right before the frame callback into the frame sent next, pinned
+	with video_broadcast_pin_frame. Nothing is drawn while a video_broadcast_present waits.
+
+	With two frames every drawing command is drawn onto both, the second time at the next
+	drain. Its entry is only free again after that, so text and bitmaps have to stay valid
+	until then, e.g. string literals or flash data. Calls and presents run once. A frame
+	callback that clears the frame wipes the commands.
+*/
+
+// --- Typedefs ---
+typedef enum {
+	C3_CMD_CLEAR,	// Clears the frame
+	C3_CMD_PIXEL,	// x0, y0
+	C3_CMD_SPAN,	// x0..x1 on y0
+	C3_CMD_RECT,	// Filled x0,y0..x1,y1
+	C3_CMD_LINE,	// x0,y0 to x1,y1
+	C3_CMD_TEXT,	// data at x0,y0, arg is the scale
+	C3_CMD_BLIT,	// c3Bitmap_t data at x0,y0, arg is C3_BLIT_xxx
+	C3_CMD_CALL,	// fn(data), once, e.g. to change state between frames
+	C3_CMD_PRESENT,	// video_broadcast_present, the rest waits for the next frame
+} c3CmdType_t;
+
+typedef void (*c3CmdFunc_t)(void *arg);
+
+/**
+ * @brief One command, fixed size
+ */
+typedef struct {
+	uint8_t type;	// c3CmdType_t
+	uint8_t color;
+	uint8_t arg;
+	uint8_t reserved;
+	int16_t x0, y0, x1, y1;
+	const void *data;
+	c3CmdFunc_t fn;
+} c3Cmd_t;
+
+// --- Public Functions ---
+/**
+ * @brief Queues a command, producer side
+ *
+ * @param cmd Command, copied
+ * @return uint8_t 0 if the ring is full, try again after the next frame
+ */
+uint8_t c3CmdPush( const c3Cmd_t *cmd );
+/**
+ * @return uint16_t Commands that can be pushed right now
+ */
+uint16_t c3CmdSpace();
+
+uint8_t c3CmdClear();
+uint8_t c3CmdPixel( int16_t x, int16_t y, uint8_t color );
+uint8_t c3CmdSpan( int16_t x0, int16_t x1, int16_t y, uint8_t color );
+uint8_t c3CmdRect( int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color );
+uint8_t c3CmdLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color );
+/**
+ * @param text Has to stay valid until drawn onto both frames
+ */
+uint8_t c3CmdText( int16_t x, int16_t y, const char *text, uint8_t scale, uint8_t color );
+/**
+ * @param bmp Has to stay valid until drawn onto both frames
+ */
+uint8_t c3CmdBlit( int16_t x, int16_t y, const c3Bitmap_t *bmp, uint8_t flags );
+uint8_t c3CmdCall( c3CmdFunc_t fn, void *arg );
+uint8_t c3CmdPresent();
+
+/**
+ * @brief Consumer side, called by the frame timer before the frame callback
+ *
+ * @return int Commands run
+ */
+int c3CmdDrain();
+
+#endif /* ESP8266CHANNEL3COMMANDRING_H */
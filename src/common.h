@@ -13,10 +13,13 @@
 
 // --- Includes ---
 #include <Arduino.h>
+#include "placement.h"
 
 // --- Defines ---
 
 // --- Marcos ---
+/** @brief Color of C3_FB_EXT64 from 2 bit red, green and blue */
+#define C3_EXT_RGB(r, g, b) ((((r)&3)<<4) | (((g)&3)<<2) | ((b)&3))
 
 // --- Typedefs ---
 /**
@@ -52,6 +55,23 @@ typedef enum {
 	C3_COL_DD_WHITE,
 } channel3ColorType_t;
 
+/**
+ * @brief Framebuffer layouts
+ */
+typedef enum {
+	C3_FB_STANDARD = 0,	// 4 bit color or double density pixels, two buffers
+	C3_FB_EXT64,		// One byte per pixel with 64 colors (C3_EXT_RGB), half the lines, two buffers. Same RAM as C3_FB_STANDARD.
+	C3_FB_INTERLACED,	// Like C3_FB_STANDARD with twice the lines, one buffer sent as two fields. Same RAM as C3_FB_STANDARD.
+	C3_FB_MIXED,		// Every line is C3_LINE_COLOR or C3_LINE_MONO, see video_broadcast_set_line_modes. Two buffers.
+	C3_FB_MONO,			// Every line is C3_LINE_MONO, two buffers in half the RAM of C3_FB_STANDARD.
+	C3_FB_STRIP,		// No framebuffer, lines are rendered just before they are sent (display_list.h)
+} channel3FramebufferMode_t;
+
+typedef enum {
+	C3_LINE_COLOR = 0,	// 4 bit color or double density pixels, 58 bytes
+	C3_LINE_MONO,		// 232 black or white pixels packed 1bpp, 29 bytes
+} channel3LineMode_t;
+
 // --- Public Vars ---
 
 // --- Public Functions ---
@@ -0,0 +1,268 @@
+/**
+ * @file display_list.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Records draw commands and rasterizes them line by line right before they are sent (C3_FB_STRIP)
+ * @version 0.1.0
+ * @date 2023-03-22
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+
+// --- Includes ---
+#include "display_list.h"
+#include "video_broadcast.h"
+#include "glyph_cache.h"
+#include "3d.h"
+
+// --- Defines ---
+#define DL_RECT 0
+#define DL_LINE 1
+#define DL_GLYPH 2
+#define DL_BITMAP 3
+
+// --- Typedefs ---
+/**
+ * @brief A recorded command. y0..y1 are the lines it touches, x0/y0 is the top end of a line or the top left corner.
+ */
+typedef struct {
+	uint8_t type;
+	uint8_t color;
+	uint16_t arg;		// DL_BITMAP: blit flags
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+	const void *ptr;	// DL_GLYPH: glyph rows; DL_BITMAP: c3Bitmap_t
+} c3DlCmd_t;
+
+/**
+ * @brief A display list, the commands of band b are cmds[bins[bandStart[b]..bandStart[b+1]-1]]
+ */
+typedef struct {
+	c3DlCmd_t cmds[C3_DL_MAX_CMDS];
+	uint16_t bins[C3_DL_MAX_BINNED];
+	uint16_t bandStart[C3_DL_BANDS+1];
+	uint16_t count;
+	uint8_t background;
+	uint8_t dropped;
+} c3DisplayList_t;
+
+// --- Private Vars ---
+static c3DisplayList_t dlLists[2];
+/** @brief List being shown, the other one is recorded */
+static volatile uint8_t dlFront;
+/** @brief Set by c3DlPresent, cleared by the renderer when it switched lists */
+static volatile uint8_t dlSwapPending;
+
+// --- Private Functions ---
+/**
+ * @brief Adds a command to the recorded list
+ *
+ * @return c3DlCmd_t* The command or NULL if the list is full or y0..y1 is off screen
+ */
+static c3DlCmd_t *addCmd( uint8_t type, uint8_t color, int y0, int y1 ){
+	c3DisplayList_t *dl = &dlLists[dlFront ^ 1];
+	if(y1 < 0 || y0 >= video_broadcast_framebuffer_height()) return NULL;
+	if(dl->count >= C3_DL_MAX_CMDS){
+		dl->dropped = 1;
+		return NULL;
+	}
+	c3DlCmd_t *cmd = &dl->cmds[dl->count++];
+	cmd->type = type;
+	cmd->color = color;
+	cmd->y0 = y0;
+	cmd->y1 = y1;
+	return cmd;
+}
+
+/**
+ * @brief n / d rounded to the nearest integer, d > 0
+ */
+static inline int divRound( int n, int d ){
+	return (n >= 0)?((n + d/2) / d):-((-n + d/2) / d);
+}
+
+/**
+ * @brief Draws the pixels of a line that fall on screen line y. Every line gets the pixels between
+ * the crossings of its upper and lower edge, so steep and flat lines stay connected.
+ */
+static void renderLine( const c3DlCmd_t *cmd, int y, uint8_t *line ){
+	int x0 = cmd->x0, x1 = cmd->x1;
+	int dx = x1 - x0;
+	int dy = cmd->y1 - cmd->y0;
+	int t = y - cmd->y0;
+	if(dy == 0){
+		video_tack_span(line, x0, x1, 0, cmd->color);
+		return;
+	}
+	if(LABS(dx) <= dy){
+		int x = x0 + divRound(t*dx, dy);
+		video_tack_span(line, x, x, 0, cmd->color);
+		return;
+	}
+	int s = (dx > 0)?1:-1;
+	int a = (t == 0)?x0:(x0 + divRound((2*t-1)*dx, 2*dy));
+	int b = (t == dy)?x1:(x0 + divRound((2*t+1)*dx, 2*dy) - s);
+	video_tack_span(line, a, b, 0, cmd->color);
+}
+
+// --- Public Functions ---
+void c3DlInit(){
+	ets_memset(dlLists, 0, sizeof(dlLists));
+	dlFront = 0;
+	dlSwapPending = 0;
+	CNFGGlyphCacheEnable(1);
+	CNFGGlyphCachePin(1);
+	video_broadcast_set_line_renderer(c3DlRenderLine);
+}
+
+uint8_t c3DlBegin( uint8_t background ){
+	if(dlSwapPending) return 0;
+	c3DisplayList_t *dl = &dlLists[dlFront ^ 1];
+	dl->count = 0;
+	dl->dropped = 0;
+	dl->background = background;
+	return 1;
+}
+
+void c3DlRect( int x0, int y0, int x1, int y1, uint8_t color ){
+	if(y0 > y1){ int t = y0; y0 = y1; y1 = t; }
+	c3DlCmd_t *cmd = addCmd(DL_RECT, color, y0, y1);
+	if(cmd == NULL) return;
+	cmd->x0 = x0;
+	cmd->x1 = x1;
+}
+
+void c3DlLine( int x0, int y0, int x1, int y1, uint8_t color ){
+	// The renderer walks from the top end
+	if(y0 > y1){
+		int t = y0; y0 = y1; y1 = t;
+		t = x0; x0 = x1; x1 = t;
+	}
+	c3DlCmd_t *cmd = addCmd(DL_LINE, color, y0, y1);
+	if(cmd == NULL) return;
+	cmd->x0 = x0;
+	cmd->x1 = x1;
+}
+
+void ICACHE_FLASH_ATTR c3DlText( const char *text, int x, int y, int scale, uint8_t color ){
+	int iox = x;
+	int ioy = y;
+	for(; *text; text++){
+		unsigned char c = *text;
+		if(c == 9){
+			iox += 12 * scale;
+			continue;
+		}
+		if(c == 10){
+			iox = x;
+			ioy += 6 * scale;
+			continue;
+		}
+		unsigned short index = FontCharMap[c&0x7f];
+		if(index != 65535){
+			int ox, oy, w, h;
+			const uint32_t *rows = CNFGGlyphRows(c, scale, &ox, &oy, &w, &h);
+			if(rows != NULL){
+				c3DlCmd_t *cmd = addCmd(DL_GLYPH, color, ioy + oy, ioy + oy + h - 1);
+				if(cmd != NULL){
+					cmd->x0 = iox + ox;
+					cmd->ptr = rows;
+				}
+			} else {
+				// Not cacheable, record the strokes
+				const unsigned char *lmap = &FontCharData[index];
+				do {
+					int x1 = (((*lmap) & 0x70)>>4)*scale + iox;
+					int y1 = ((*lmap) & 0x0f)*scale + ioy;
+					int x2 = (((*(lmap+1)) & 0x70)>>4)*scale + iox;
+					int y2 = ((*(lmap+1)) & 0x0f)*scale + ioy;
+					lmap++;
+					c3DlLine(x1, y1, x2, y2, color);
+				} while(!(*(lmap++) & 0x80));
+			}
+		}
+		iox += 3 * scale;
+	}
+}
+
+void c3DlBitmap( const c3Bitmap_t *bmp, int x, int y, uint8_t flags ){
+	c3DlCmd_t *cmd = addCmd(DL_BITMAP, 0, y, y + bmp->height - 1);
+	if(cmd == NULL) return;
+	cmd->x0 = x;
+	cmd->arg = flags;
+	cmd->ptr = bmp;
+}
+
+uint8_t ICACHE_FLASH_ATTR c3DlPresent(){
+	c3DisplayList_t *dl = &dlLists[dlFront ^ 1];
+	int lastBand = (video_broadcast_framebuffer_height() - 1) >> C3_DL_BAND_SHIFT;
+	ets_memset(dl->bandStart, 0, sizeof(dl->bandStart));
+
+	// Count the commands per band, commands that do not fit into the bins any more are dropped
+	int total = 0;
+	for(int i = 0; i < dl->count; i++){
+		c3DlCmd_t *cmd = &dl->cmds[i];
+		int b0 = (cmd->y0 < 0)?0:(cmd->y0 >> C3_DL_BAND_SHIFT);
+		int b1 = cmd->y1 >> C3_DL_BAND_SHIFT;
+		if(b1 > lastBand) b1 = lastBand;
+		if(total + b1 - b0 + 1 > C3_DL_MAX_BINNED){
+			dl->count = i;
+			dl->dropped = 1;
+			break;
+		}
+		total += b1 - b0 + 1;
+		for(int b = b0; b <= b1; b++) dl->bandStart[b+1]++;
+	}
+	for(int b = 0; b < C3_DL_BANDS; b++) dl->bandStart[b+1] += dl->bandStart[b];
+
+	// Fill the bins in drawing order, bandStart[b] runs up to the start of band b+1 meanwhile
+	for(int i = 0; i < dl->count; i++){
+		c3DlCmd_t *cmd = &dl->cmds[i];
+		int b0 = (cmd->y0 < 0)?0:(cmd->y0 >> C3_DL_BAND_SHIFT);
+		int b1 = cmd->y1 >> C3_DL_BAND_SHIFT;
+		if(b1 > lastBand) b1 = lastBand;
+		for(int b = b0; b <= b1; b++) dl->bins[dl->bandStart[b]++] = i;
+	}
+	for(int b = C3_DL_BANDS; b > 0; b--) dl->bandStart[b] = dl->bandStart[b-1];
+	dl->bandStart[0] = 0;
+
+	dlSwapPending = 1;
+	return !dl->dropped;
+}
+
+void c3DlRenderLine( int y, uint16_t *line ){
+	// Lists only change at the top of a field
+	if(y == 0 && dlSwapPending){
+		dlFront ^= 1;
+		dlSwapPending = 0;
+	}
+	c3DisplayList_t *dl = &dlLists[dlFront];
+
+	uint16_t bg = 0;
+	if(dl->background < C3_COL_DD_BLACK) bg = dl->background * 0x1111;
+	else if(dl->background == C3_COL_DD_WHITE) bg = 0xaaaa;
+	for(int i = 0; i < video_broadcast_framebuffer_width()/8; i++) line[i] = bg;
+
+	int band = y >> C3_DL_BAND_SHIFT;
+	if(band >= C3_DL_BANDS) return;
+	for(int i = dl->bandStart[band]; i < dl->bandStart[band+1]; i++){
+		const c3DlCmd_t *cmd = &dl->cmds[dl->bins[i]];
+		if(y < cmd->y0 || y > cmd->y1) continue;
+		switch(cmd->type){
+			case DL_RECT:
+				video_tack_span((uint8_t*)line, cmd->x0, cmd->x1, 0, cmd->color);
+				break;
+			case DL_LINE:
+				renderLine(cmd, y, (uint8_t*)line);
+				break;
+			case DL_GLYPH:
+				CNFGBlitGlyphRow(line, ((const uint32_t*)cmd->ptr)[y - cmd->y0], cmd->x0, cmd->color);
+				break;
+			case DL_BITMAP:
+				c3BlitLine((const c3Bitmap_t*)cmd->ptr, cmd->x0, cmd->y0, cmd->arg, line, y);
+				break;
+		}
+	}
+}
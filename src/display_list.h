@@ -0,0 +1,80 @@
+/**
+ * @file display_list.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Records draw commands and rasterizes them line by line right before they are sent (C3_FB_STRIP)
+ * @version 0.1.0
+ * @date 2023-03-22
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+#ifndef ESP8266CHANNEL3DISPLAYLIST_H
+#define ESP8266CHANNEL3DISPLAYLIST_H
+
+// --- Includes ---
+#include <c_types.h>
+#include "common.h"
+#include "blit.h"
+
+// --- Defines ---
+#ifndef C3_DL_MAX_CMDS
+/** @brief Commands per display list, there are two lists (shown and recorded) */
+#define C3_DL_MAX_CMDS 128
+#endif
+#ifndef C3_DL_MAX_BINNED
+/** @brief Command references over all bands, a command is referenced by every band it touches */
+#define C3_DL_MAX_BINNED 512
+#endif
+#ifndef C3_DL_BAND_SHIFT
+/** @brief Lines per band as a power of two */
+#define C3_DL_BAND_SHIFT 3
+#endif
+#define C3_DL_BAND_LINES (1 << C3_DL_BAND_SHIFT)
+/** @brief Bands of the highest (PAL) screen */
+#define C3_DL_BANDS ((264 + C3_DL_BAND_LINES - 1) >> C3_DL_BAND_SHIFT)
+
+// --- Public Functions ---
+/**
+ * @brief Makes the display list the line renderer. Call after channel3InitMode(..., C3_FB_STRIP, ...).
+ * Enables and pins the glyph cache, text refers to the cached glyphs. Without RAM for it text is
+ * recorded as lines.
+ */
+void c3DlInit();
+/**
+ * @brief Starts recording a new list
+ *
+ * @param background Color of everything not drawn over, channel3ColorType_t
+ * @return uint8_t 0 if the last presented list is not shown yet, nothing can be recorded then
+ */
+uint8_t c3DlBegin( uint8_t background );
+/**
+ * @brief Filled rectangle, corners inclusive. X in pixels of the color type like video_broadcast_tack_span.
+ */
+void c3DlRect( int x0, int y0, int x1, int y1, uint8_t color );
+/**
+ * @brief Line between two points
+ */
+void c3DlLine( int x0, int y0, int x1, int y1, uint8_t color );
+/**
+ * @brief Text like CNFGDrawText, pen at x, y. Characters that do not fit into the glyph cache are recorded as strokes.
+ */
+void c3DlText( const char *text, int x, int y, int scale, uint8_t color );
+/**
+ * @brief Bitmap like c3Blit. The bitmap has to stay valid as long as the list is shown.
+ */
+void c3DlBitmap( const c3Bitmap_t *bmp, int x, int y, uint8_t flags );
+/**
+ * @brief Sorts the recorded commands into bands and shows the list from the next field on
+ *
+ * @return uint8_t 0 if commands were dropped because the list or the bands were full
+ */
+uint8_t c3DlPresent();
+/**
+ * @brief Line renderer (videoLineRenderer_t) drawing the shown list
+ *
+ * @param y Line on screen
+ * @param line Line to fill
+ */
+void c3DlRenderLine( int y, uint16_t *line );
+
+#endif /* ESP8266CHANNEL3DISPLAYLIST_H */
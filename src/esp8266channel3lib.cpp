@@ -27,38 +27,138 @@ static os_timer_t runTimer;
 static int runTimerPeriod;
 static bool runFlag;
 
+/** @brief Length of one frame in us */
+static uint32_t framePeriodUs;
+/** @brief The frame callback runs every divisor-th frame */
+static uint8_t frameDivisor = 1;
+/** @brief Highest divisor the governor may pick, 1 if it is off */
+static uint8_t governorMax = 1;
+static frameRateCB governorCB;
+/** @brief Callbacks in a row the average stayed low enough for the next higher frame rate */
+static uint16_t governorLow;
+/** @brief Holding the framebuffer and presenting after every callback */
+static uint8_t paced;
+static int lastRenderFrame;
+/** @brief 8 times the rolling average of the render time */
+static uint32_t renderSum8;
+static uint32_t fpsStart;
+static uint16_t fpsFrames;
+static channel3FrameStats_t frameStats;
+
 // --- Private Functions ---
+/**
+ * @brief Frame timer period and render budget of a standard
+ */
+LOCAL void ICACHE_FLASH_ATTR setFrameRate( channel3VideoType_t videoType ){
+	if(videoType == PAL){
+		runTimerPeriod = 1000 / FRAME_FREQUENCY_PAL;
+		framePeriodUs = 1000000 / FRAME_FREQUENCY_PAL;
+	} else {
+		runTimerPeriod = 1000 / FRAME_FREQUENCY_NTSC;
+		framePeriodUs = 1000000 / FRAME_FREQUENCY_NTSC;
+	}
+}
+
+/**
+ * @brief Frame rates below the full rate draw into a held framebuffer and present it when done,
+ * so every image stays on screen for the same number of frames
+ */
+LOCAL void ICACHE_FLASH_ATTR updatePacing(){
+	uint8_t p = frameDivisor > 1 || governorMax > 1;
+	if(p == paced) return;
+	paced = p;
+	video_broadcast_hold(p);
+}
+
+LOCAL void setDivisor( uint8_t divisor ){
+	if(divisor == frameDivisor) return;
+	frameDivisor = divisor;
+	frameStats.divisor = divisor;
+	governorLow = 0;
+	if(governorCB != NULL) governorCB(divisor);
+}
+
+/**
+ * @brief Takes the render time of a callback into the statistics and lets the governor react
+ */
+LOCAL void accountRender( uint32_t us ){
+	frameStats.renderUs = us;
+	renderSum8 = renderSum8 - renderSum8/8 + us;
+	frameStats.renderAvgUs = renderSum8/8;
+	if(us > frameStats.renderMaxUs) frameStats.renderMaxUs = us;
+	frameStats.rendered++;
+
+	uint32_t now = micros();
+	fpsFrames++;
+	if(now - fpsStart >= 1000000){
+		frameStats.fps100 = (uint16_t)(((uint64_t)fpsFrames*100000000ULL) / (now - fpsStart));
+		fpsStart = now;
+		fpsFrames = 0;
+	}
+
+	uint32_t budget = framePeriodUs*frameDivisor;
+	if(us > budget) frameStats.overruns++;
+	if(governorMax <= 1) return;
+	uint32_t avg = frameStats.renderAvgUs;
+	if(frameDivisor < governorMax && avg*100 > budget*C3_GOVERNOR_UP){
+		setDivisor(frameDivisor + 1);
+	} else if(frameDivisor > 1 && avg*100 < framePeriodUs*(frameDivisor-1)*C3_GOVERNOR_DOWN){
+		if(++governorLow >= C3_GOVERNOR_HOLD) setDivisor(frameDivisor - 1);
+	} else {
+		governorLow = 0;
+	}
+}
+
 /**
  * @brief Timer callback to load a frame
  */
 LOCAL void ICACHE_FLASH_ATTR frameTimer(){
-	static uint8_t lastframe = 0;
-	uint8_t tbuffer = !(video_broadcast_get_frame_number()&1);
-	if( lastframe != tbuffer ) // New frame
-	{
-        if(frameCB != NULL){
-            frameCB(); //callback
-        }
-		lastframe = tbuffer;
+	int frame = video_broadcast_get_frame_number();
+	if(frame == lastRenderFrame) return;
+	if(paced){
+		// The last image has to be out and on screen for frameDivisor frames
+		if(video_broadcast_present_pending() || frame - lastRenderFrame < frameDivisor) return;
+	}
+	lastRenderFrame = frame;
+
+	uint32_t start = micros();
+	C3_TRACE_EVENT(C3_TRACE_CAT_FRAME, C3_TR_DRAIN, C3_TRACE_BEGIN, 0);
+	c3CmdDrain(); // Commands from loop() first, at one defined point per frame
+	C3_TRACE_EVENT(C3_TRACE_CAT_FRAME, C3_TR_DRAIN, C3_TRACE_END, 0);
+	if(frameCB != NULL){
+		C3_TRACE_EVENT(C3_TRACE_CAT_FRAME, C3_TR_RENDER, C3_TRACE_BEGIN, frame);
+		frameCB(); //callback
+		C3_TRACE_EVENT(C3_TRACE_CAT_FRAME, C3_TR_RENDER, C3_TRACE_END, frame);
 	}
+	if(paced) video_broadcast_present();
+	accountRender(micros() - start);
 }
 
 // --- Public Vars ---
 
 // --- Public Functions ---
-void ICACHE_FLASH_ATTR channel3Init(channel3VideoType_t videoType, loadFrameCB loadFrameCB){
+uint8_t ICACHE_FLASH_ATTR channel3Init(channel3VideoType_t videoType, loadFrameCB loadFrameCB){
+    return channel3InitMode(videoType, C3_FB_STANDARD, loadFrameCB);
+}
+
+uint8_t ICACHE_FLASH_ATTR channel3InitMode(channel3VideoType_t videoType, channel3FramebufferMode_t mode, loadFrameCB loadFrameCB){
+    // The frame timer only starts once all video memory is there
+    if(!video_broadcast_init_mode(videoType, mode)) return 0;
     videoStandard = videoType;
     frameCB = loadFrameCB;
-    if(videoStandard == PAL){
-        runTimerPeriod = 1000 / FRAME_FREQUENCY_PAL;
-    } else {
-        runTimerPeriod = 1000 / FRAME_FREQUENCY_NTSC;
-    }
+    setFrameRate(videoStandard);
+    paced = 0;
+    lastRenderFrame = -1;
+    renderSum8 = 0;
+    fpsStart = micros();
+    fpsFrames = 0;
+    ets_memset(&frameStats, 0, sizeof(frameStats));
+    frameStats.divisor = frameDivisor;
     os_timer_setfn(&runTimer, (os_timer_func_t *)frameTimer, NULL);
     os_timer_arm(&runTimer, runTimerPeriod, 1);
     runFlag = true;
-
-    video_broadcast_init(videoStandard);
+    updatePacing();
+    return 1;
 }
 
 void channel3Deinit(){
@@ -66,6 +166,17 @@ void channel3Deinit(){
     video_broadcast_deinit();
 }
 
+uint8_t ICACHE_FLASH_ATTR channel3SetStandard(channel3VideoType_t videoType){
+    if(!video_broadcast_set_standard(videoType)) return 0;
+    videoStandard = videoType;
+    setFrameRate(videoStandard);
+    if(runFlag){
+        os_timer_disarm(&runTimer);
+        os_timer_arm(&runTimer, runTimerPeriod, 1);
+    }
+    return 1;
+}
+
 void channel3StopBroadcast(){
     if(runFlag){
         os_timer_disarm(&runTimer);
@@ -79,4 +190,32 @@ void channel3StartBroadcast(){
         os_timer_arm(&runTimer, runTimerPeriod, 1);
         runFlag = true;
     }
-}
\ No newline at end of file
+}
+
+void ICACHE_FLASH_ATTR channel3SetFrameDivisor(uint8_t divisor){
+    if(divisor == 0) divisor = 1;
+    governorMax = 1;
+    governorCB = NULL;
+    setDivisor(divisor);
+    updatePacing();
+}
+
+void ICACHE_FLASH_ATTR channel3SetGovernor(uint8_t maxDivisor, frameRateCB cb){
+    if(maxDivisor == 0) maxDivisor = 1;
+    governorMax = maxDivisor;
+    governorCB = cb;
+    governorLow = 0;
+    if(frameDivisor > maxDivisor) setDivisor(maxDivisor);
+    updatePacing();
+}
+
+uint8_t channel3GetFrameDivisor(){
+    return frameDivisor;
+}
+
+const channel3FrameStats_t *channel3GetFrameStats(uint8_t resetMax){
+    static channel3FrameStats_t copy;
+    copy = frameStats;
+    if(resetMax) frameStats.renderMaxUs = 0;
+    return &copy;
+}
@@ -17,8 +17,29 @@
 #include "common.h"
 #include "video_broadcast.h"
 #include "3d.h"
+#include "render_queue.h"
+#include "mesh.h"
+#include "glyph_cache.h"
+#include "blit.h"
+#include "display_list.h"
+#include "video_player.h"
+#include "net_ingest.h"
+#include "command_ring.h"
+#include "trace.h"
 
 // --- Defines ---
+#ifndef C3_GOVERNOR_UP
+/** @brief Percent of the frame budget the average render time may take before the governor lowers the frame rate */
+#define C3_GOVERNOR_UP 90
+#endif
+#ifndef C3_GOVERNOR_DOWN
+/** @brief Percent of the budget of the next higher frame rate the average has to stay below to go back up */
+#define C3_GOVERNOR_DOWN 75
+#endif
+#ifndef C3_GOVERNOR_HOLD
+/** @brief Renders in a row the average has to stay that low before the frame rate goes up */
+#define C3_GOVERNOR_HOLD 60
+#endif
 
 // --- Marcos ---
 
@@ -29,6 +50,25 @@
  * @param frame Pointer to the frame buffer
  */ 
 typedef void (*loadFrameCB)();
+/**
+ * @brief Called by the governor when it changed the frame rate, right before the next frame callback
+ * 
+ * @param divisor The frame callback runs every divisor-th frame now
+ */
+typedef void (*frameRateCB)(uint8_t divisor);
+
+/**
+ * @brief Render timing, the render time is the frame callback plus the command ring
+ */
+typedef struct {
+	uint32_t renderUs;		// Last render
+	uint32_t renderAvgUs;	// Rolling average over about 8 renders
+	uint32_t renderMaxUs;	// Longest since the last reset
+	uint32_t rendered;		// Renders since init
+	uint32_t overruns;		// Renders longer than their budget, frame period times divisor
+	uint16_t fps100;		// Renders per second times 100, over the last second
+	uint8_t divisor;		// The frame callback runs every divisor-th frame
+} channel3FrameStats_t;
 // --- Public Vars ---
 
 // --- Public Functions ---
@@ -38,13 +78,33 @@ typedef void (*loadFrameCB)();
  * 
  * @param videoType The video type to use
  * @param loadFrameCB The callback function to load a frame
+ * @return uint8_t 1 if it runs, 0 if there was not enough memory (see video_broadcast_set_arena)
  */
-void ICACHE_FLASH_ATTR channel3Init(channel3VideoType_t videoType, loadFrameCB loadFrameCB);
+uint8_t ICACHE_FLASH_ATTR channel3Init(channel3VideoType_t videoType, loadFrameCB loadFrameCB);
+/**
+ * @brief Initialize the channel 3 library with another framebuffer layout, e.g. C3_FB_EXT64
+ * 
+ * @param videoType The video type to use
+ * @param mode The framebuffer layout
+ * @param loadFrameCB The callback function to load a frame
+ * @return uint8_t 1 if it runs, 0 if there was not enough memory
+ */
+uint8_t ICACHE_FLASH_ATTR channel3InitMode(channel3VideoType_t videoType, channel3FramebufferMode_t mode, loadFrameCB loadFrameCB);
 /**
  * @brief Deinitialize the channel 3 library
  */
 void channel3Deinit();
 
+/**
+ * @brief Changes between NTSC and PAL at the end of the current frame, keeping the broadcast and the
+ * framebuffer (video_broadcast_set_standard). The frame timer follows the new frame rate. To go from
+ * NTSC to PAL call video_broadcast_reserve_standards(1) before the init.
+ * 
+ * @param videoType NTSC or PAL
+ * @return uint8_t 1 if the change is pending, 0 if the framebuffer is too small for it
+ */
+uint8_t ICACHE_FLASH_ATTR channel3SetStandard(channel3VideoType_t videoType);
+
 /**
  * @brief Stop the broadcast
  */
@@ -54,4 +114,32 @@ void channel3StopBroadcast();
  */
 void channel3StartBroadcast();
 
+/**
+ * @brief Runs the frame callback only every divisor-th frame, e.g. 2 for 30 Hz (NTSC) or 25 Hz (PAL).
+ * Above 1 the framebuffer is held (video_broadcast_hold) and presented after every callback, so each
+ * image is shown for the same number of frames. Turns the governor off.
+ * 
+ * @param divisor 1 for every frame
+ */
+void ICACHE_FLASH_ATTR channel3SetFrameDivisor(uint8_t divisor);
+/**
+ * @brief Lets the library pick the divisor: if the average render time gets close to the budget the
+ * frame rate drops to the next lower one, once it stays well below the budget of the higher one it goes
+ * back up (C3_GOVERNOR_UP, C3_GOVERNOR_DOWN, C3_GOVERNOR_HOLD). Holds the framebuffer like
+ * channel3SetFrameDivisor, not to be combined with c3NetBegin.
+ * 
+ * @param maxDivisor Lowest frame rate, e.g. 3 for 20 Hz (NTSC) or 16.7 Hz (PAL). 1 turns the governor off.
+ * @param cb Told about every change, e.g. to draw less. Can be NULL.
+ */
+void ICACHE_FLASH_ATTR channel3SetGovernor(uint8_t maxDivisor, frameRateCB cb);
+/**
+ * @return uint8_t The frame callback runs every that many frames
+ */
+uint8_t channel3GetFrameDivisor();
+/**
+ * @param resetMax Start measuring renderMaxUs again
+ * @return const channel3FrameStats_t* Render timing, a copy valid until the next call
+ */
+const channel3FrameStats_t *channel3GetFrameStats(uint8_t resetMax);
+
 #endif /* ESP8266CHANNEL3LIB_H */
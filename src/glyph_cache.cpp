@@ -0,0 +1,275 @@
+/**
+ * @file glyph_cache.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Caches CNFGDrawText characters as 1bpp bitmaps so they are blitted instead of stroked
+ * @version 0.1.0
+ * @date 2023-03-18
+ * 
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ * 
+ */
+
+// --- Includes ---
+#include "glyph_cache.h"
+#include "3d.h"
+
+// --- Defines ---
+#define GLYPH_EMPTY 0
+
+// --- Typedefs ---
+/**
+ * @brief A cached glyph. Row r of the bitmap is glyphPool[row+r], bit 0 is the leftmost pixel.
+ */
+typedef struct {
+	uint8_t c;		// Character, GLYPH_EMPTY for free slots
+	uint8_t scale;
+	int8_t ox;		// Offset of the bitmap from the pen position
+	int8_t oy;
+	uint8_t w;
+	uint8_t h;
+	uint16_t row;	// First row in glyphPool
+} cnfgGlyph_t;
+
+// --- Private Vars ---
+/** @brief Allocated together on the first CNFGGlyphCacheEnable(1), NULL until then */
+static cnfgGlyph_t *glyphSlots;
+static uint32_t *glyphPool;
+static uint16_t glyphPoolUsed;
+static uint16_t glyphSlotsUsed;
+static uint8_t glyphCacheOn;
+/** @brief Set while glyph rows are referenced from elsewhere, the cache is not flushed when full then */
+static uint8_t glyphCachePinned;
+
+/** @brief Target of the capture plotter while a glyph is rasterized */
+static uint32_t *captureRows;
+static int captureHeight;
+
+/** @brief Nibble masks for 4 pixels of a color mode halfword */
+static const uint16_t nibbleMask[16] = {
+	0x0000, 0x000f, 0x00f0, 0x00ff, 0x0f00, 0x0f0f, 0x0ff0, 0x0fff,
+	0xf000, 0xf00f, 0xf0f0, 0xf0ff, 0xff00, 0xff0f, 0xfff0, 0xffff,
+};
+
+// --- Private Functions ---
+/** @brief CNFGTackPixel replacement that records into the glyph being built */
+static void capturePixel( int x, int y ){
+	if(x < 0 || x >= CNFG_GLYPH_MAX_WIDTH || y < 0 || y >= captureHeight) return;
+	captureRows[y] |= 1u << x;
+}
+
+/**
+ * @brief Spreads 8 bits onto the odd bits of a halfword (the double density pixel positions)
+ */
+static inline uint16_t spreadDD( uint32_t b ){
+	b = (b | (b << 4)) & 0x0f0f;
+	b = (b | (b << 2)) & 0x3333;
+	b = (b | (b << 1)) & 0x5555;
+	return b << 1;
+}
+
+/**
+ * @brief Bounding box of all strokes of a glyph, relative to the pen position
+ */
+static void ICACHE_FLASH_ATTR glyphBox( unsigned char c, int scale, int *minx, int *miny, int *w, int *h ){
+	const unsigned char *lmap = &FontCharData[FontCharMap[c&0x7f]];
+	int maxx = 0, maxy = 0;
+	*minx = 255;
+	*miny = 255;
+	do {
+		int x = ((*lmap & 0x70)>>4)*scale;
+		int y = (*lmap & 0x0f)*scale;
+		if(x < *minx) *minx = x;
+		if(x > maxx) maxx = x;
+		if(y < *miny) *miny = y;
+		if(y > maxy) maxy = y;
+	} while(!(*(lmap++) & 0x80));
+	*w = maxx - *minx + 1;
+	*h = maxy - *miny + 1;
+}
+
+/**
+ * @brief Rasterizes a glyph into the pool with the regular line drawer, the pool has room for its h rows
+ * 
+ * @return cnfgGlyph_t* The filled in slot
+ */
+static cnfgGlyph_t *ICACHE_FLASH_ATTR buildGlyph( cnfgGlyph_t *slot, unsigned char c, int scale, int minx, int miny, int w, int h ){
+	slot->c = c;
+	slot->scale = scale;
+	slot->ox = minx;
+	slot->oy = miny;
+	slot->w = w;
+	slot->h = h;
+	slot->row = glyphPoolUsed;
+	glyphPoolUsed += h;
+	glyphSlotsUsed++;
+
+	// Stroke the glyph through CNFGTackSegment so it matches the uncached output. That only holds
+	// on screen, CNFGTackSegment drops whole strokes that cross the edge, see CNFGBlitGlyph.
+	void (*lastTackPixel)( int x, int y ) = CNFGTackPixel;
+	captureRows = &glyphPool[slot->row];
+	captureHeight = h;
+	ets_memset(captureRows, 0, h*sizeof(uint32_t));
+	CNFGTackPixel = capturePixel;
+	const unsigned char *lmap = &FontCharData[FontCharMap[c&0x7f]];
+	do {
+		int x1 = (((*lmap) & 0x70)>>4)*scale - minx;
+		int y1 = ((*lmap) & 0x0f)*scale - miny;
+		int x2 = (((*(lmap+1)) & 0x70)>>4)*scale - minx;
+		int y2 = ((*(lmap+1)) & 0x0f)*scale - miny;
+		lmap++;
+		CNFGTackSegment(x1, y1, x2, y2);
+	} while(!(*(lmap++) & 0x80));
+	CNFGTackPixel = lastTackPixel;
+	return slot;
+}
+
+/**
+ * @brief Finds a glyph in the cache or builds it
+ */
+static cnfgGlyph_t *C3_DRAW_ATTR findGlyph( unsigned char c, int scale ){
+	uint32_t home = ((c * 31u) ^ (scale * 7u)) & (CNFG_GLYPH_SLOTS-1);
+	uint32_t h = home;
+	for(;;){
+		cnfgGlyph_t *slot = &glyphSlots[h];
+		if(slot->c == c && slot->scale == scale) return slot;
+		if(slot->c == GLYPH_EMPTY) break;
+		h = (h+1) & (CNFG_GLYPH_SLOTS-1);
+	}
+	int minx, miny, w, rows;
+	glyphBox(c, scale, &minx, &miny, &w, &rows);
+	if(w > CNFG_GLYPH_MAX_WIDTH || rows > CNFG_GLYPH_POOL_WORDS) return NULL;
+	// Keep the table at most 3/4 full so probing stays short. Flushed before the glyph is placed,
+	// so it goes to its home slot and the next lookup finds it there.
+	if(glyphSlotsUsed >= (CNFG_GLYPH_SLOTS*3)/4 || glyphPoolUsed + rows > CNFG_GLYPH_POOL_WORDS){
+		if(glyphCachePinned) return NULL;
+		CNFGGlyphCacheFlush();
+		h = home;
+	}
+	return buildGlyph(&glyphSlots[h], c, scale, minx, miny, w, rows);
+}
+
+/**
+ * @brief Blits one glyph row onto a framebuffer row
+ * 
+ * @param row Framebuffer row, 29 halfwords
+ * @param bits Glyph row, bit 0 is at x
+ * @param x X-Coordinate, already clipped to >= 0
+ * @param width Row width in pixels of the current color type
+ */
+static inline void blitRow( uint16_t *row, uint32_t bits, int x, int width, uint8_t color ){
+	if(x + CNFG_GLYPH_MAX_WIDTH > width){
+		bits &= (x >= width)?0:(0xffffffffu >> (CNFG_GLYPH_MAX_WIDTH - (width - x)));
+	}
+	if(color >= C3_COL_DD_BLACK){
+		// 8 pixels per halfword
+		uint64_t v = (uint64_t)bits << (x & 7);
+		uint16_t *hw = &row[x >> 3];
+		if(color == C3_COL_DD_WHITE){
+			for(; v; v >>= 8) *(hw++) |= spreadDD(v & 0xff);
+		} else {
+			for(; v; v >>= 8) *(hw++) &= ~spreadDD(v & 0xff);
+		}
+	} else {
+		// 4 pixels per halfword
+		uint64_t v = (uint64_t)bits << (x & 3);
+		uint16_t *hw = &row[x >> 2];
+		uint16_t cw = color * 0x1111;
+		for(; v; v >>= 4, hw++){
+			uint16_t m = nibbleMask[v & 0x0f];
+			*hw = (*hw & ~m) | (cw & m);
+		}
+	}
+}
+
+/**
+ * @brief Blits one glyph row onto a packed 1bpp row, double density colors only
+ */
+static inline void blitRowMono( uint8_t *row, uint32_t bits, int x, int width, uint8_t color ){
+	if(x + CNFG_GLYPH_MAX_WIDTH > width){
+		bits &= (x >= width)?0:(0xffffffffu >> (CNFG_GLYPH_MAX_WIDTH - (width - x)));
+	}
+	uint64_t v = (uint64_t)bits << (x & 7);
+	uint8_t *b = &row[x >> 3];
+	if(color == C3_COL_DD_WHITE){
+		for(; v; v >>= 8) *(b++) |= v & 0xff;
+	} else {
+		for(; v; v >>= 8) *(b++) &= ~(v & 0xff);
+	}
+}
+
+// --- Public Functions ---
+uint8_t ICACHE_FLASH_ATTR CNFGGlyphCacheEnable( uint8_t enable ){
+	if(enable && glyphSlots == NULL){
+		// Slots first, they are 4 byte aligned like the pool behind them
+		uint8_t *mem = (uint8_t*)malloc(CNFG_GLYPH_SLOTS*sizeof(cnfgGlyph_t) + CNFG_GLYPH_POOL_WORDS*sizeof(uint32_t));
+		if(mem == NULL) return 0;
+		glyphSlots = (cnfgGlyph_t*)mem;
+		glyphPool = (uint32_t*)(mem + CNFG_GLYPH_SLOTS*sizeof(cnfgGlyph_t));
+		CNFGGlyphCacheFlush();
+	}
+	glyphCacheOn = enable;
+	return 1;
+}
+
+uint8_t CNFGGlyphCacheEnabled(){
+	return glyphCacheOn;
+}
+
+void CNFGGlyphCachePin( uint8_t pin ){
+	glyphCachePinned = pin;
+}
+
+void CNFGGlyphCacheFlush(){
+	if(glyphSlots == NULL) return;
+	ets_memset(glyphSlots, 0, CNFG_GLYPH_SLOTS*sizeof(cnfgGlyph_t));
+	glyphPoolUsed = 0;
+	glyphSlotsUsed = 0;
+}
+
+int C3_DRAW_ATTR CNFGBlitGlyph( unsigned char c, int x, int y, int scale ){
+	uint8_t color = CNFGLastColor;
+	if(glyphSlots == NULL || c == GLYPH_EMPTY || scale <= 0 || scale > 255 || color > C3_COL_DD_WHITE) return 0;
+	// 64 colors and color text on 1bpp lines are drawn pixel by pixel
+	channel3FramebufferMode_t mode = video_broadcast_get_mode();
+	if(mode == C3_FB_EXT64 || mode == C3_FB_STRIP) return 0;
+	if((mode == C3_FB_MIXED || mode == C3_FB_MONO) && color < C3_COL_DD_BLACK) return 0;
+
+	cnfgGlyph_t *g = findGlyph(c, scale);
+	if(g == NULL) return 0;
+
+	int width = (color >= C3_COL_DD_BLACK)?video_broadcast_framebuffer_width():video_broadcast_framebuffer_width()/2;
+	int height = video_broadcast_framebuffer_height();
+	int gx = x + g->ox;
+	int gy = y + g->oy;
+	// Glyphs crossing the edge are stroked, clipping the bitmap per pixel would keep parts of
+	// the strokes CNFGTackSegment drops
+	if(gx < 0 || gy < 0 || gx + g->w > width || gy + g->h > height) return 0;
+	uint32_t *rows = &glyphPool[g->row];
+
+	for(int r = 0; r < g->h; r++){
+		if(video_broadcast_line_mode(gy + r) == C3_LINE_MONO) blitRowMono(video_broadcast_get_line(gy + r), rows[r], gx, width, color);
+		else blitRow((uint16_t*)video_broadcast_get_line(gy + r), rows[r], gx, width, color);
+	}
+	return 1;
+}
+
+const uint32_t *CNFGGlyphRows( unsigned char c, int scale, int *ox, int *oy, int *w, int *h ){
+	if(glyphSlots == NULL || c == GLYPH_EMPTY || scale <= 0 || scale > 255) return NULL;
+	cnfgGlyph_t *g = findGlyph(c, scale);
+	if(g == NULL) return NULL;
+	*ox = g->ox;
+	*oy = g->oy;
+	*w = g->w;
+	*h = g->h;
+	return &glyphPool[g->row];
+}
+
+void CNFGBlitGlyphRow( uint16_t *row, uint32_t bits, int x, uint8_t color ){
+	if(color > C3_COL_DD_WHITE) return;
+	if(x < 0){
+		if(x <= -CNFG_GLYPH_MAX_WIDTH) return;
+		bits >>= -x;
+		x = 0;
+	}
+	blitRow(row, bits, x, (color >= C3_COL_DD_BLACK)?video_broadcast_framebuffer_width():video_broadcast_framebuffer_width()/2, color);
+}
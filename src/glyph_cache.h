@@ -0,0 +1,89 @@
+/**
+ * @file glyph_cache.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Caches CNFGDrawText characters as 1bpp bitmaps so they are blitted instead of stroked
+ * @version 0.1.0
+ * @date 2023-03-18
+ * 
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ * 
+ */
+#ifndef ESP8266CHANNEL3GLYPHCACHE_H
+#define ESP8266CHANNEL3GLYPHCACHE_H
+
+// --- Includes ---
+#include <c_types.h>
+
+// --- Defines ---
+// The cache is allocated from the heap on the first CNFGGlyphCacheEnable(1) and kept from then on:
+// 8 bytes per slot plus 4 per pool word, 4 kB (1 kB slots, 3 kB pool) with the defaults. Lower both
+// to save RAM, a full cache is flushed and refilled, so a small one still works, it strokes more often.
+#ifndef CNFG_GLYPH_SLOTS
+/** @brief Number of (character, scale) pairs that can be cached. Must be a power of two. 8 bytes each. */
+#define CNFG_GLYPH_SLOTS 128
+#endif
+#ifndef CNFG_GLYPH_POOL_WORDS
+/** @brief Bitmap storage, one 32 bit word per glyph row */
+#define CNFG_GLYPH_POOL_WORDS 768
+#endif
+/** @brief Glyphs wider than this (scale > 7) are always stroked */
+#define CNFG_GLYPH_MAX_WIDTH 32
+
+// --- Public Functions ---
+/**
+ * @brief Enables or disables the glyph cache for CNFGDrawText (disabled by default).
+ * The first enable allocates the cache, disabling it does not free it.
+ * 
+ * @param enable 0 to always stroke the characters
+ * @return uint8_t 0 if the cache could not be allocated, it stays disabled then
+ */
+uint8_t CNFGGlyphCacheEnable( uint8_t enable );
+/**
+ * @return uint8_t 1 if CNFGDrawText uses the glyph cache
+ */
+uint8_t CNFGGlyphCacheEnabled();
+/**
+ * @brief Drops every cached glyph
+ */
+void CNFGGlyphCacheFlush();
+/**
+ * @brief Keeps the cached glyphs in place: a full cache is not flushed, new glyphs are not cached then.
+ * Needed while glyph rows from CNFGGlyphRows are used, e.g. by a display list.
+ * 
+ * @param pin 1 to pin the cache
+ */
+void CNFGGlyphCachePin( uint8_t pin );
+/**
+ * @brief Draws a character from the cache with CNFGLastColor, rasterizing it first if needed.
+ * Characters that do not fit on screen completely are left to the caller.
+ * 
+ * @param c Character
+ * @param x Pen X-Coordinate
+ * @param y Pen Y-Coordinate
+ * @param scale Scale as in CNFGDrawText
+ * @return int 0 if the character can not be cached or crosses the screen edge, the caller has to stroke it then
+ */
+int CNFGBlitGlyph( unsigned char c, int x, int y, int scale );
+/**
+ * @brief Gets a character from the cache, rasterizing it first if needed
+ * 
+ * @param c Character
+ * @param scale Scale as in CNFGDrawText
+ * @param ox Offset of the bitmap from the pen position
+ * @param oy
+ * @param w Width of the bitmap
+ * @param h Height of the bitmap
+ * @return const uint32_t* h rows, bit 0 is the leftmost pixel. NULL if the character can not be cached.
+ */
+const uint32_t *CNFGGlyphRows( unsigned char c, int scale, int *ox, int *oy, int *w, int *h );
+/**
+ * @brief Draws one glyph row onto a C3_FB_STANDARD line
+ * 
+ * @param row The line
+ * @param bits Glyph row, bit 0 is at x
+ * @param x X-Coordinate, clipped to the line
+ * @param color channel3ColorType_t up to C3_COL_DD_WHITE
+ */
+void CNFGBlitGlyphRow( uint16_t *row, uint32_t bits, int x, uint8_t color );
+
+#endif /* ESP8266CHANNEL3GLYPHCACHE_H */
@@ -0,0 +1,116 @@
+/**
+ * @file mesh.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Compact meshes that stay in flash and are read in place
+ * @version 0.1.0
+ * @date 2023-03-14
+ * 
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ * 
+ */
+
+// --- Includes ---
+#include "mesh.h"
+#include "render_queue.h"
+
+// --- Private Vars ---
+// Geosphere, 42 vertices and 120 edges. Generated from the former verts[]/indices[] tables.
+static const uint32_t geoSphereVerts[] PROGMEM = {
+	0xff000000, 0x00000000, 0xff8e00b9, 0x00000086, 0xff8effba, 0x000000d9, 0xff8eff1c, 0x00000000,
+	0xff8effba, 0x0000ff27, 0xff8e00b9, 0x0000ff7a, 0x00720046, 0x000000d9, 0x0072ff47, 0x00000086,
+	0x0072ff47, 0x0000ff7a, 0x00720046, 0x0000ff27, 0x007200e4, 0x00000000, 0x01000000, 0x00000000,
+	0xff27006c, 0x0000004f, 0xff27ffd7, 0x0000007f, 0xff7a0043, 0x000000cf, 0xff27006c, 0x0000ffb1,
+	0xff7a00d9, 0x00000000, 0xff27ff7a, 0x00000000, 0xff7aff50, 0x0000007f, 0xff27ffd7, 0x0000ff81,
+	0xff7aff50, 0x0000ff81, 0xff7a0043, 0x0000ff31, 0x000000f3, 0x0000ffb1, 0x000000f3, 0x0000004f,
+	0x00000096, 0x000000cf, 0x00000000, 0x00000100, 0x0000ff6a, 0x000000cf, 0x0000ff0d, 0x0000004f,
+	0x0000ff0d, 0x0000ffb1, 0x0000ff6a, 0x0000ff31, 0x00000000, 0x0000ff00, 0x00000096, 0x0000ff31,
+	0x008600b0, 0x0000007f, 0x0086ffbd, 0x000000cf, 0x0086ff27, 0x00000000, 0x0086ffbd, 0x0000ff31,
+	0x008600b0, 0x0000ff81, 0x00d90086, 0x00000000, 0x00d90029, 0x0000007f, 0x00d9ff94, 0x0000004f,
+	0x00d9ff94, 0x0000ffb1, 0x00d90029, 0x0000ff81,
+};
+static const uint32_t geoSphereEdges[] PROGMEM = {
+	0x010c0c0e, 0x0d0e0e01, 0x0d020c0d, 0x000d020e, 0x01100c00, 0x0f0c100c, 0x1005100f, 0x0f00050f,
+	0x12020d12, 0x0d111112, 0x03121103, 0x11140011, 0x13141403, 0x13041113, 0x00130414, 0x15041315,
+	0x130f0f15, 0x01170515, 0x16101710, 0x170a1716, 0x16050a16, 0x190e0219, 0x1918180e, 0x06181906,
+	0x031b1801, 0x1a121b12, 0x1b071b1a, 0x1a02071a, 0x1d14041d, 0x1d1c1c14, 0x081c1d08, 0x051f1c03,
+	0x1e151f15, 0x1f091f1e, 0x1e04091e, 0x200a1720, 0x17181820, 0x19210620, 0x1a212106, 0x0721191a,
+	0x22071b22, 0x1b1c1c22, 0x1d230822, 0x1e232308, 0x09231d1e, 0x24091f24, 0x1f161624, 0x06260a24,
+	0x25202620, 0x260b2625, 0x250a0b25, 0x27210727, 0x27262621, 0x0828270b, 0x27222822, 0x280b2827,
+	0x29230929, 0x29282823, 0x2524290b, 0x25292924,
+};
+
+// --- Public Vars ---
+const tdMesh_t tdGeoSphereMesh = {
+	geoSphereVerts, geoSphereEdges, NULL,
+	42, 120, 0,
+	TD_MESH_POS16, 0,
+	{ 0, 0, 0 }, 256
+};
+
+// --- Public Functions ---
+void tdMeshVertex( const tdMesh_t *mesh, uint16_t index, int16_t *out ){
+	if(mesh->flags & TD_MESH_POS16){
+		uint32_t xy = pgm_read_dword(&mesh->verts[index*2]);
+		uint32_t z = pgm_read_dword(&mesh->verts[index*2+1]);
+		out[0] = (int16_t)(xy & 0xffff) << mesh->posShift;
+		out[1] = (int16_t)(xy >> 16) << mesh->posShift;
+		out[2] = (int16_t)(z & 0xffff) << mesh->posShift;
+	} else {
+		uint32_t xyz = pgm_read_dword(&mesh->verts[index]);
+		out[0] = (int8_t)(xyz & 0xff) << mesh->posShift;
+		out[1] = (int8_t)((xyz >> 8) & 0xff) << mesh->posShift;
+		out[2] = (int8_t)((xyz >> 16) & 0xff) << mesh->posShift;
+	}
+}
+
+uint16_t tdMeshIndex( const tdMesh_t *mesh, const uint32_t *list, uint32_t n ){
+	if(mesh->flags & TD_MESH_IDX16){
+		return (pgm_read_dword(&list[n>>1]) >> ((n&1)<<4)) & 0xffff;
+	}
+	return (pgm_read_dword(&list[n>>2]) >> ((n&3)<<3)) & 0xff;
+}
+
+void ICACHE_FLASH_ATTR tdDrawMeshWire( const tdMesh_t *mesh ){
+	int16_t c1[3], c2[3];
+	if(mesh->edges == NULL) return;
+	if(!tdSphereInFrustum((int16_t*)mesh->center, mesh->radius)) return;
+
+	for(uint32_t i = 0; i < mesh->nedges; i++){
+		tdMeshVertex(mesh, tdMeshIndex(mesh, mesh->edges, i*2), c1);
+		tdMeshVertex(mesh, tdMeshIndex(mesh, mesh->edges, i*2+1), c2);
+		Draw3DSegment(c1, c2);
+	}
+}
+
+void ICACHE_FLASH_ATTR tdDrawMeshSolid( const tdMesh_t *mesh, uint8_t color ){
+	int16_t c1[3], c2[3], c3[3];
+	uint8_t lastColor = CNFGLastColor;
+	if(mesh->faces == NULL) return;
+	if(!tdSphereInFrustum((int16_t*)mesh->center, mesh->radius)) return;
+
+	CNFGColor(color);
+	for(uint32_t i = 0; i < mesh->nfaces; i++){
+		tdMeshVertex(mesh, tdMeshIndex(mesh, mesh->faces, i*3), c1);
+		tdMeshVertex(mesh, tdMeshIndex(mesh, mesh->faces, i*3+1), c2);
+		tdMeshVertex(mesh, tdMeshIndex(mesh, mesh->faces, i*3+2), c3);
+		if(color == TD_MESH_SHADED) CNFGColor(CNFGShadeColor(tdFaceLight(c1, c2, c3)));
+		Draw3DTriangle(c1, c2, c3);
+	}
+	CNFGColor(lastColor);
+}
+
+int ICACHE_FLASH_ATTR tdQueueMesh( const tdMesh_t *mesh, uint8_t color ){
+	int16_t c1[3], c2[3], c3[3];
+	int used = 0;
+	if(mesh->faces == NULL) return 0;
+	if(!tdSphereInFrustum((int16_t*)mesh->center, mesh->radius)) return 0;
+
+	for(uint32_t i = 0; i < mesh->nfaces; i++){
+		tdMeshVertex(mesh, tdMeshIndex(mesh, mesh->faces, i*3), c1);
+		tdMeshVertex(mesh, tdMeshIndex(mesh, mesh->faces, i*3+1), c2);
+		tdMeshVertex(mesh, tdMeshIndex(mesh, mesh->faces, i*3+2), c3);
+		uint8_t c = (color == TD_MESH_SHADED)?CNFGShadeColor(tdFaceLight(c1, c2, c3)):color;
+		used += tdQueueTriangle(c1, c2, c3, c);
+	}
+	return used;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file mesh.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Compact meshes that stay in flash and are read in place
+ * @version 0.1.0
+ * @date 2023-03-14
+ * 
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ * 
+ */
+#ifndef ESP8266CHANNEL3MESH_H
+#define ESP8266CHANNEL3MESH_H
+
+// --- Includes ---
+#include <c_types.h>
+#include "3d.h"
+
+// --- Defines ---
+/** @brief Positions are int16 (two words per vertex) instead of int8 (one word per vertex) */
+#define TD_MESH_POS16 0x01
+/** @brief Indices are uint16 (two per word) instead of uint8 (four per word) */
+#define TD_MESH_IDX16 0x02
+
+/** @brief Pass as color to shade each face by how much it faces the camera */
+#define TD_MESH_SHADED 0xff
+
+// --- Typedefs ---
+/**
+ * @brief Mesh descriptor. The arrays it points to live in flash (PROGMEM) and are only ever read
+ * with aligned 32 bit accesses, so nothing is copied to RAM. Use tools/obj2mesh.py to create them.
+ * 
+ * verts: 8 bit positions are packed x | y<<8 | z<<16, 16 bit positions as x | y<<16 followed by z.
+ *        Decoded positions are the stored values shifted left by posShift.
+ * edges: Pairs of vertex indices, for wireframes. May be NULL.
+ * faces: Triples of vertex indices, front faces run clockwise on screen. May be NULL.
+ */
+typedef struct {
+	const uint32_t *verts;
+	const uint32_t *edges;
+	const uint32_t *faces;
+	uint16_t nverts;
+	uint16_t nedges;
+	uint16_t nfaces;
+	uint8_t flags;
+	uint8_t posShift;
+	int16_t center[3];	// Bounding sphere, in decoded units
+	int16_t radius;
+} tdMesh_t;
+
+// --- Public Vars ---
+/** @brief The geosphere drawn by DrawGeoSphere() */
+extern const tdMesh_t tdGeoSphereMesh;
+
+// --- Public Functions ---
+/**
+ * @brief Decodes a vertex position
+ * 
+ * @param mesh Mesh to read
+ * @param index Vertex index
+ * @param out x, y, z
+ */
+void tdMeshVertex( const tdMesh_t *mesh, uint16_t index, int16_t *out );
+/**
+ * @brief Reads an entry of an edge or face index list
+ * 
+ * @param mesh Mesh the list belongs to
+ * @param list mesh->edges or mesh->faces
+ * @param n Entry number
+ * @return uint16_t Vertex index
+ */
+uint16_t tdMeshIndex( const tdMesh_t *mesh, const uint32_t *list, uint32_t n );
+/**
+ * @brief Draws the edges of a mesh with the current matrices and color.
+ * Meshes outside of the view frustum are skipped before any vertex is transformed.
+ * 
+ * @param mesh Mesh to draw
+ */
+void ICACHE_FLASH_ATTR tdDrawMeshWire( const tdMesh_t *mesh );
+/**
+ * @brief Draws the faces of a mesh unsorted, fine for convex meshes
+ * 
+ * @param mesh Mesh to draw
+ * @param color Fill color or TD_MESH_SHADED
+ */
+void ICACHE_FLASH_ATTR tdDrawMeshSolid( const tdMesh_t *mesh, uint8_t color );
+/**
+ * @brief Queues the faces of a mesh in the depth sorted render queue, see render_queue.h
+ * 
+ * @param mesh Mesh to queue
+ * @param color Fill color or TD_MESH_SHADED
+ * @return int Number of queue entries used
+ */
+int ICACHE_FLASH_ATTR tdQueueMesh( const tdMesh_t *mesh, uint8_t color );
+
+#endif /* ESP8266CHANNEL3MESH_H */
@@ -0,0 +1,341 @@
+/**
+ * @file net_ingest.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Receives frames over UDP or TCP straight into the back buffer (tools/c3netsend.py)
+ * @version 0.1.0
+ * @date 2023-03-25
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+
+// --- Includes ---
+#include "net_ingest.h"
+#include "video_broadcast.h"
+#include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
+
+// --- Defines ---
+#define OP_SKIP 0
+#define OP_COPY 1
+#define OP_FILL 2
+#define OP_UP 3
+
+// --- Private Vars ---
+static uint8_t listening = 0;
+/** @brief Length of the TCP packet waited for, 0 until its length arrived */
+static uint16_t tcpPending;
+/** @brief Where the status goes, the last sender */
+static uint8_t replyTcp;
+static IPAddress replyIp;
+static uint16_t replyPort;
+
+static uint16_t stride;
+static uint16_t lines;
+static c3NetStats_t stats;
+
+/** @brief A frame is being received */
+static uint8_t assembling;
+/** @brief A frame was started since c3NetBegin, curSeq is valid */
+static uint8_t haveSeq;
+static uint16_t curSeq;
+/** @brief Packets of the current frame that arrived, by index */
+static uint32_t partMask[256/32];
+/** @brief Packets of the current frame, 0 until the last one arrived */
+static uint16_t partCount;
+/** @brief All packets of the current frame were keyframe packets */
+static uint8_t frameKey;
+/** @brief The back buffer does not hold the frame on screen, i.e. after a present */
+static uint8_t needSync;
+static uint8_t resync;
+
+// --- Private Functions ---
+/*
+	The sockets are constructed on first use. As globals their constructors would run in every
+	sketch that includes the library and link the Wi-Fi stack even without c3NetBegin.
+*/
+LOCAL WiFiUDP &netUdp(){
+	static WiFiUDP udp;
+	return udp;
+}
+LOCAL WiFiServer &netServer(){
+	static WiFiServer server(0);
+	return server;
+}
+LOCAL WiFiClient &netClient(){
+	static WiFiClient client;
+	return client;
+}
+
+LOCAL void sendStatus(){
+	uint8_t r[C3N_STATUS_BYTES];
+	r[0] = C3N_MAGIC & 0xff;
+	r[1] = C3N_MAGIC >> 8;
+	r[2] = stats.lastSeq & 0xff;
+	r[3] = stats.lastSeq >> 8;
+	r[4] = resync?C3N_RESYNC:0;
+	r[5] = video_broadcast_get_mode();
+	r[6] = stride & 0xff;
+	r[7] = stride >> 8;
+	r[8] = lines & 0xff;
+	r[9] = lines >> 8;
+	r[10] = stats.presented & 0xff;
+	r[11] = stats.presented >> 8;
+	r[12] = stats.dropped & 0xff;
+	r[13] = stats.dropped >> 8;
+	if(replyTcp){
+		if(netClient().connected()) netClient().write(r, sizeof(r));
+	} else if(replyPort != 0){
+		netUdp().beginPacket(replyIp, replyPort);
+		netUdp().write(r, sizeof(r));
+		netUdp().endPacket();
+	}
+}
+
+/**
+ * @brief Reads and drops the rest of a packet
+ */
+LOCAL void discard( Stream *s, uint16_t len ){
+	uint8_t scratch[32];
+	while(len){
+		int n = s->read(scratch, (len < sizeof(scratch))?len:sizeof(scratch));
+		if(n <= 0) return;
+		len -= n;
+	}
+}
+
+/**
+ * @brief The current frame can not be completed any more
+ */
+LOCAL void dropFrame(){
+	if(!assembling) return;
+	assembling = 0;
+	stats.dropped++;
+	resync = 1;
+	sendStatus();
+}
+
+/**
+ * @brief Applies the operations of a packet onto lines first..first+count-1 of frame
+ *
+ * @param used Set to the bytes read from s, also when the packet is broken
+ * @return uint8_t 0 if the packet is broken
+ */
+LOCAL uint8_t applyOps( Stream *s, uint16_t len, uint8_t *frame, uint16_t first, uint16_t count, uint16_t *used ){
+	uint32_t at = first*stride;
+	uint32_t end = (first + count)*stride;
+	*used = 0;
+	while(*used < len){
+		int op = s->read();
+		if(op < 0) return 0;
+		(*used)++;
+		uint32_t n = op & 0x3f;
+		if(n == 0){
+			uint8_t c[2];
+			if(len - *used < 2) return 0;
+			int got = s->read(c, 2);
+			if(got > 0) *used += got;
+			if(got != 2) return 0;
+			n = c[0] | (c[1]<<8);
+		}
+		if(at + n > end) return 0;
+
+		switch(op >> 6){
+			case OP_SKIP:
+				break;
+			case OP_COPY: {
+				// Straight from the network buffers into the frame
+				if(n > (uint32_t)(len - *used)) return 0;
+				int got = s->read(frame + at, n);
+				if(got > 0) *used += got;
+				if(got != (int)n) return 0;
+				break;
+			}
+			case OP_FILL: {
+				if(*used == len) return 0;
+				int v = s->read();
+				if(v < 0) return 0;
+				(*used)++;
+				ets_memset(frame + at, v, n);
+				break;
+			}
+			case OP_UP:
+				if(at < stride || n > stride) return 0;
+				memcpy(frame + at, frame + at - stride, n);
+				break;
+		}
+		at += n;
+	}
+	return 1;
+}
+
+/**
+ * @brief Handles one packet of len bytes waiting in s
+ */
+LOCAL void handlePacket( Stream *s, uint16_t len ){
+	uint8_t h[C3N_HEADER_BYTES];
+	stats.packets++;
+	int got = (len < C3N_HEADER_BYTES || len > C3_NET_MAX_PACKET)?0:s->read(h, C3N_HEADER_BYTES);
+	if(got != C3N_HEADER_BYTES){
+		stats.badPackets++;
+		discard(s, len - ((got > 0)?got:0));
+		return;
+	}
+	len -= C3N_HEADER_BYTES;
+	uint16_t magic = h[0] | (h[1]<<8);
+	uint16_t seq = h[2] | (h[3]<<8);
+	uint16_t first = h[4] | (h[5]<<8);
+	uint16_t count = h[6] | (h[7]<<8);
+	uint8_t flags = h[8];
+	uint8_t part = h[9];
+	if(magic != C3N_MAGIC || first + count > lines){
+		stats.badPackets++;
+		discard(s, len);
+		return;
+	}
+	if(count == 0){
+		discard(s, len);
+		sendStatus();
+		return;
+	}
+
+	// Older frames are done with, a newer one ends the current frame
+	if(!assembling || seq != curSeq){
+		if(haveSeq && (int16_t)(seq - curSeq) <= 0){
+			stats.latePackets++;
+			discard(s, len);
+			return;
+		}
+		dropFrame();
+		if(haveSeq && seq != (uint16_t)(curSeq + 1)){
+			// Whole frames went missing, the next deltas do not fit onto the back buffer
+			stats.dropped += (uint16_t)(seq - curSeq - 1);
+			resync = 1;
+		}
+		// Start from the frame on screen
+		uint8_t *sent = video_broadcast_get_sent_frame();
+		if(needSync && sent != video_broadcast_get_frame()) memcpy(video_broadcast_get_frame(), sent, video_broadcast_frame_bytes());
+		needSync = 0;
+		assembling = 1;
+		haveSeq = 1;
+		curSeq = seq;
+		ets_memset(partMask, 0, sizeof(partMask));
+		partCount = 0;
+		frameKey = 1;
+	}
+
+	uint8_t *frame = video_broadcast_get_frame();
+	if(flags & C3N_KEY) ets_memset(frame + first*stride, 0, count*stride);
+	else frameKey = 0;
+	uint16_t used;
+	if(!applyOps(s, len, frame, first, count, &used)){
+		// Over TCP the next length follows right after this packet
+		discard(s, len - used);
+		stats.badPackets++;
+		dropFrame();
+		return;
+	}
+
+	partMask[part >> 5] |= 1UL << (part & 31);
+	if(flags & C3N_LAST) partCount = part + 1;
+	if(partCount == 0) return;
+	for(int i = 0; i < partCount; i++){
+		if(!(partMask[i >> 5] & (1UL << (i & 31)))) return;
+	}
+
+	// Complete. After a loss only a keyframe shows something sensible again.
+	assembling = 0;
+	if(resync && !frameKey){
+		stats.dropped++;
+		sendStatus();
+		return;
+	}
+	video_broadcast_present();
+	needSync = 1;
+	resync = 0;
+	stats.presented++;
+	stats.lastSeq = seq;
+	sendStatus();
+}
+
+// --- Public Functions ---
+uint8_t ICACHE_FLASH_ATTR c3NetBegin( uint16_t port ){
+	channel3FramebufferMode_t mode = video_broadcast_get_mode();
+	if(mode == C3_FB_MIXED || mode == C3_FB_STRIP) return 0;
+	lines = video_broadcast_framebuffer_height();
+	stride = video_broadcast_frame_bytes() / lines;
+	video_broadcast_hold(1);
+
+	ets_memset(&stats, 0, sizeof(stats));
+	assembling = 0;
+	haveSeq = 0;
+	needSync = 1;
+	resync = 1;
+	tcpPending = 0;
+	replyTcp = 0;
+	replyPort = 0;
+	netUdp().begin(port);
+	netServer().begin(port);
+	listening = 1;
+	return 1;
+}
+
+void ICACHE_FLASH_ATTR c3NetEnd(){
+	if(!listening) return;
+	netUdp().stop();
+	netClient().stop();
+	netServer().stop();
+	video_broadcast_hold(0);
+	listening = 0;
+}
+
+int c3NetPoll(){
+	if(!listening) return 0;
+	WiFiUDP &udp = netUdp();
+	WiFiServer &tcpServer = netServer();
+	WiFiClient &tcpClient = netClient();
+	// A new connection replaces the old one
+	if(tcpServer.hasClient()){
+		tcpClient.stop();
+		tcpClient = tcpServer.available();
+		tcpPending = 0;
+	}
+
+	int handled = 0;
+	while(!video_broadcast_present_pending()){
+		if(tcpClient.connected()){
+			if(tcpPending == 0 && tcpClient.available() >= 2){
+				uint8_t l[2];
+				tcpClient.read(l, 2);
+				tcpPending = l[0] | (l[1]<<8);
+				if(tcpPending > C3_NET_MAX_PACKET){
+					// Would never fit into the receive window, the stream is out of step
+					stats.badPackets++;
+					tcpClient.stop();
+					tcpPending = 0;
+					break;
+				}
+			}
+			// Only whole packets, they are applied in one go like UDP packets
+			if(tcpPending != 0 && tcpClient.available() >= tcpPending){
+				replyTcp = 1;
+				handlePacket(&tcpClient, tcpPending);
+				tcpPending = 0;
+				handled++;
+				continue;
+			}
+		}
+		int len = udp.parsePacket();
+		if(len <= 0) break;
+		replyTcp = 0;
+		replyIp = udp.remoteIP();
+		replyPort = udp.remotePort();
+		handlePacket(&udp, len);
+		handled++;
+	}
+	return handled;
+}
+
+const c3NetStats_t *c3NetGetStats(){
+	return &stats;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file net_ingest.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Receives frames over UDP or TCP straight into the back buffer (tools/c3netsend.py)
+ * @version 0.1.0
+ * @date 2023-03-25
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+#ifndef ESP8266CHANNEL3NETINGEST_H
+#define ESP8266CHANNEL3NETINGEST_H
+
+// --- Includes ---
+#include <c_types.h>
+#include "common.h"
+
+// --- Defines ---
+#ifndef C3_NET_MAX_PACKET
+/** @brief Longest packet accepted, longer ones are dropped */
+#define C3_NET_MAX_PACKET 1472
+#endif
+
+/** @brief "C3" */
+#define C3N_MAGIC 0x3343
+/** @brief Bytes of the packet header */
+#define C3N_HEADER_BYTES 10
+/** @brief Bytes of the status reply */
+#define C3N_STATUS_BYTES 14
+
+/** @brief Packet flag: last packet of the frame, its index is the number of packets - 1 */
+#define C3N_LAST 0x01
+/** @brief Packet flag: the lines start from black instead of the previous frame */
+#define C3N_KEY 0x02
+/** @brief Status flag: a frame was lost, the next frame should be all keyframe packets */
+#define C3N_RESYNC 0x01
+
+/*
+	Packets, all little endian. Over TCP every packet is preceded by its length as uint16.
+
+	uint16 magic, uint16 frame sequence number, uint16 first line, uint16 lines,
+	uint8 flags, uint8 index of the packet in the frame, operations
+
+	The operations are the ones of video_player.h (SKIP, COPY, FILL, UP), applied to the
+	bytes of the lines first..first+lines-1 of the back buffer. Packets of a frame can come
+	in any order, the frame is presented once all of them arrived. Packets of older frames
+	are dropped, a newer frame drops an incomplete one. A packet with 0 lines only asks for
+	the status.
+
+	Status reply to the last sender: uint16 magic, uint16 sequence number presented last,
+	uint8 flags, uint8 channel3FramebufferMode_t, uint16 bytes per line, uint16 lines,
+	uint16 frames presented, uint16 frames dropped
+*/
+
+// --- Typedefs ---
+/**
+ * @brief Counters since c3NetBegin
+ */
+typedef struct {
+	uint32_t packets;
+	uint32_t badPackets;	// Broken, too long or lines out of range
+	uint32_t latePackets;	// Of a frame that was presented or dropped already
+	uint16_t presented;
+	uint16_t dropped;
+	uint16_t lastSeq;
+} c3NetStats_t;
+
+// --- Public Functions ---
+/**
+ * @brief Listens on UDP and TCP port. Holds the framebuffer (video_broadcast_hold), so only
+ * complete frames are shown. Needs a mode with one byte offset per line, i.e. not C3_FB_MIXED or
+ * C3_FB_STRIP. C3_FB_INTERLACED needs a back buffer (video_broadcast_set_back_buffer).
+ *
+ * @param port Port for both protocols
+ * @return uint8_t 0 if the mode is not supported
+ */
+uint8_t ICACHE_FLASH_ATTR c3NetBegin( uint16_t port );
+/**
+ * @brief Stops listening and lets the framebuffers alternate again
+ */
+void ICACHE_FLASH_ATTR c3NetEnd();
+/**
+ * @brief Call from loop(). Applies every packet waiting, but none while a presented frame waits
+ * for the end of the field.
+ *
+ * @return int Packets applied
+ */
+int c3NetPoll();
+/**
+ * @return const c3NetStats_t* Counters
+ */
+const c3NetStats_t *c3NetGetStats();
+
+#endif /* ESP8266CHANNEL3NETINGEST_H */
@@ -0,0 +1,59 @@
+/**
+ * @file placement.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief IRAM or flash placement of the drawing hot paths, chosen by C3_PLACEMENT_PROFILE
+ * @version 0.1.0
+ * @date 2023-03-28
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+#ifndef ESP8266CHANNEL3PLACEMENT_H
+#define ESP8266CHANNEL3PLACEMENT_H
+
+// --- Includes ---
+#include <c_types.h>
+
+// --- Defines ---
+/** @brief Profiles for C3_PLACEMENT_PROFILE */
+#define C3_PLACE_MIN_IRAM 0		// Everything in flash, no IRAM used
+#define C3_PLACE_BALANCED 1		// Per pixel and per vertex code in IRAM
+#define C3_PLACE_MAX_SPEED 2	// Also text, rectangles, matrices and clipping
+
+#ifndef C3_PLACEMENT_PROFILE
+/**
+ * @brief Set for the whole library, e.g. build_flags = -DC3_PLACEMENT_PROFILE=2. Code in flash runs
+ * from the 32 kB instruction cache and stalls on every miss, the frame callback shares that cache
+ * with the SDK and the sketch. IRAM never misses, but Wi-Fi needs most of it.
+ */
+#define C3_PLACEMENT_PROFILE C3_PLACE_BALANCED
+#endif
+
+// --- Macros ---
+/*
+	C3_PIXEL_ATTR	runs per pixel or span, e.g. video_tack_pixel, CNFGTackSegment
+	C3_VERTEX_ATTR	runs per vertex or sample, e.g. tdPTransform, LocalToScreenspace, tdNoise2D
+	C3_DRAW_ATTR	runs per primitive with a loop inside, e.g. CNFGDrawText, CNFGTackRectangle, tdMultiply
+	Setup code stays ICACHE_FLASH_ATTR. Only put these on definitions, not on declarations. Whatever
+	a placed function calls per pixel, like video_broadcast_get_frame, needs the same attribute.
+*/
+#if C3_PLACEMENT_PROFILE == C3_PLACE_MIN_IRAM
+#define C3_PIXEL_ATTR ICACHE_FLASH_ATTR
+#define C3_VERTEX_ATTR ICACHE_FLASH_ATTR
+#define C3_DRAW_ATTR ICACHE_FLASH_ATTR
+#define C3_PLACEMENT_NAME "min_iram"
+#elif C3_PLACEMENT_PROFILE == C3_PLACE_BALANCED
+#define C3_PIXEL_ATTR IRAM_ATTR
+#define C3_VERTEX_ATTR IRAM_ATTR
+#define C3_DRAW_ATTR ICACHE_FLASH_ATTR
+#define C3_PLACEMENT_NAME "balanced"
+#elif C3_PLACEMENT_PROFILE == C3_PLACE_MAX_SPEED
+#define C3_PIXEL_ATTR IRAM_ATTR
+#define C3_VERTEX_ATTR IRAM_ATTR
+#define C3_DRAW_ATTR IRAM_ATTR
+#define C3_PLACEMENT_NAME "max_speed"
+#else
+#error "C3_PLACEMENT_PROFILE has to be C3_PLACE_MIN_IRAM, C3_PLACE_BALANCED or C3_PLACE_MAX_SPEED"
+#endif
+
+#endif /* ESP8266CHANNEL3PLACEMENT_H */
@@ -0,0 +1,108 @@
+/**
+ * @file render_queue.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Depth sorted face queue for solid 3D rendering (painter's algorithm)
+ * @version 0.1.0
+ * @date 2023-03-12
+ * 
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ * 
+ */
+
+// --- Includes ---
+#include "render_queue.h"
+
+// --- Defines ---
+#define TD_QUEUE_END 0xffff
+
+// --- Typedefs ---
+/**
+ * @brief A projected face waiting to be drawn
+ */
+typedef struct {
+	int32_t x[3];
+	int32_t y[3];
+	int32_t depth;	// -(w0+w1+w2), bigger is further away
+	uint16_t next;	// Next face in the same bucket
+	uint8_t color;
+} tdQueuedFace_t;
+
+// --- Private Vars ---
+static tdQueuedFace_t facePool[TD_QUEUE_FACES];
+static uint16_t bucketHead[TD_QUEUE_BUCKETS];
+static uint16_t faceCount;
+
+// --- Private Functions ---
+/**
+ * @brief Takes a face from the pool
+ * 
+ * @return tdQueuedFace_t* The face or NULL if the pool is exhausted
+ */
+static tdQueuedFace_t *allocFace(){
+	if(faceCount >= TD_QUEUE_FACES) return NULL;
+	return &facePool[faceCount++];
+}
+
+// --- Public Functions ---
+void tdQueueReset(){
+	faceCount = 0;
+}
+
+int ICACHE_FLASH_ATTR tdQueueTriangle( int16_t * c1, int16_t * c2, int16_t * c3, uint8_t color ){
+	int sx[4], sy[4];
+	int16_t w[4];
+	int used = 0;
+
+	// Projection depends on the color type (double density or not)
+	uint8_t lastColor = CNFGLastColor;
+	CNFGColor(color);
+	int n = tdProjectTriangle(c1, c2, c3, sx, sy, w);
+	CNFGColor(lastColor);
+
+	// Near clipping may have turned the triangle into a quad: queue it as a fan
+	for(int i = 1; i < n-1; i++){
+		tdQueuedFace_t *f = allocFace();
+		if(f == NULL) break;
+		f->x[0] = sx[0]; f->y[0] = sy[0];
+		f->x[1] = sx[i]; f->y[1] = sy[i];
+		f->x[2] = sx[i+1]; f->y[2] = sy[i+1];
+		f->depth = -((int32_t)w[0] + w[i] + w[i+1]);
+		f->color = color;
+		used++;
+	}
+	return used;
+}
+
+void ICACHE_FLASH_ATTR tdQueueFlush(){
+	if(faceCount == 0) return;
+
+	// Depth range of this frame, so the buckets cover only what is there
+	int32_t dmin = facePool[0].depth;
+	int32_t dmax = dmin;
+	for(int i = 1; i < faceCount; i++){
+		if(facePool[i].depth < dmin) dmin = facePool[i].depth;
+		if(facePool[i].depth > dmax) dmax = facePool[i].depth;
+	}
+	int shift = 0;
+	while(((dmax - dmin) >> shift) >= TD_QUEUE_BUCKETS) shift++;
+
+	// Bucket sort into singly linked lists
+	for(int i = 0; i < TD_QUEUE_BUCKETS; i++) bucketHead[i] = TD_QUEUE_END;
+	for(int i = 0; i < faceCount; i++){
+		int b = (facePool[i].depth - dmin) >> shift;
+		facePool[i].next = bucketHead[b];
+		bucketHead[b] = i;
+	}
+
+	// Draw far to near
+	uint8_t lastColor = CNFGLastColor;
+	for(int b = TD_QUEUE_BUCKETS-1; b >= 0; b--){
+		for(uint16_t i = bucketHead[b]; i != TD_QUEUE_END; i = facePool[i].next){
+			tdQueuedFace_t *f = &facePool[i];
+			CNFGColor(f->color);
+			CNFGTackTriangle(f->x[0], f->y[0], f->x[1], f->y[1], f->x[2], f->y[2]);
+		}
+	}
+	CNFGColor(lastColor);
+	faceCount = 0;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file render_queue.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Depth sorted face queue for solid 3D rendering (painter's algorithm)
+ * @version 0.1.0
+ * @date 2023-03-12
+ * 
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ * 
+ */
+#ifndef ESP8266CHANNEL3RENDERQUEUE_H
+#define ESP8266CHANNEL3RENDERQUEUE_H
+
+// --- Includes ---
+#include <c_types.h>
+#include "3d.h"
+
+// --- Defines ---
+#ifndef TD_QUEUE_FACES
+/** @brief Number of triangles the queue can hold per frame */
+#define TD_QUEUE_FACES 128
+#endif
+#ifndef TD_QUEUE_BUCKETS
+/** @brief Number of depth buckets used for sorting */
+#define TD_QUEUE_BUCKETS 64
+#endif
+
+// --- Public Functions ---
+/**
+ * @brief Empties the queue without drawing anything
+ */
+void tdQueueReset();
+/**
+ * @brief Transforms a triangle with the current ModelviewMatrix/ProjectionMatrix and queues it.
+ * Faces behind the camera or facing away are dropped here already.
+ * 
+ * @param c1 First vertex (x,y,z)
+ * @param c2 Second vertex
+ * @param c3 Third vertex
+ * @param color Color to fill the face with
+ * @return int Number of queue entries used (0 if culled or the queue is full)
+ */
+int ICACHE_FLASH_ATTR tdQueueTriangle( int16_t * c1, int16_t * c2, int16_t * c3, uint8_t color );
+/**
+ * @brief Sorts all queued faces by depth, draws them back to front and empties the queue
+ */
+void ICACHE_FLASH_ATTR tdQueueFlush();
+
+#endif /* ESP8266CHANNEL3RENDERQUEUE_H */
@@ -0,0 +1,69 @@
+/**
+ * @file trace.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Optional ring of timestamped events from the video interrupt, the frame path and the sketch (tools/c3trace2json.py)
+ * @version 0.1.0
+ * @date 2023-03-27
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+
+// --- Includes ---
+#include "trace.h"
+
+#if C3_TRACE
+#if (C3_TRACE_EVENTS & (C3_TRACE_EVENTS-1)) != 0
+#error "C3_TRACE_EVENTS has to be a power of two"
+#endif
+
+// --- Public Vars ---
+c3TraceEvent_t c3TraceRing[C3_TRACE_EVENTS];
+volatile uint32_t c3TraceHead;
+volatile uint8_t c3TraceMask;
+
+// --- Public Functions ---
+void c3TraceStart( uint8_t categories ){
+	c3TraceMask = 0;
+	c3TraceHead = 0;
+	c3TraceMask = categories;
+}
+
+void c3TraceStop(){
+	c3TraceMask = 0;
+}
+
+uint16_t c3TraceDump( Print *out ){
+	c3TraceStop();
+	uint32_t head = c3TraceHead;
+	uint32_t count = (head < C3_TRACE_EVENTS)?head:C3_TRACE_EVENTS;
+	/*
+		c3trace begin <CPU MHz> <events>
+		<cycle counter, hex> <id> <phase> <arg>
+		c3trace end
+	*/
+	out->printf("c3trace begin %u %u\n", system_get_cpu_freq(), count);
+	for(uint32_t i = head - count; i != head; i++){
+		const c3TraceEvent_t *e = &c3TraceRing[i & (C3_TRACE_EVENTS-1)];
+		out->printf("%08x %u %c %u\n", e->ccount, e->id, e->phase, e->arg);
+		if((i & 63) == 0) yield();
+	}
+	out->printf("c3trace end\n");
+	return count;
+}
+
+#else
+
+void c3TraceStart( uint8_t categories ){
+	(void)categories;
+}
+
+void c3TraceStop(){
+}
+
+uint16_t c3TraceDump( Print *out ){
+	out->printf("c3trace begin 0 0\nc3trace end\n");
+	return 0;
+}
+
+#endif
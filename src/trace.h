@@ -0,0 +1,120 @@
+/**
+ * @file trace.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Optional ring of timestamped events from the video interrupt, the frame path and the sketch (tools/c3trace2json.py)
+ * @version 0.1.0
+ * @date 2023-03-27
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+#ifndef ESP8266CHANNEL3TRACE_H
+#define ESP8266CHANNEL3TRACE_H
+
+// --- Includes ---
+#include <c_types.h>
+#include "common.h"
+
+// --- Defines ---
+#ifndef C3_TRACE
+/** @brief Build the whole library and the sketch with C3_TRACE=1 to record events, else the macros are empty */
+#define C3_TRACE 0
+#endif
+#ifndef C3_TRACE_EVENTS
+/** @brief Events the ring holds, a power of two. 8 bytes each, one per line sent while C3_TR_LINE is on */
+#define C3_TRACE_EVENTS 1024
+#endif
+
+/** @brief Event phases, as in the Chrome trace format */
+#define C3_TRACE_BEGIN 'B'
+#define C3_TRACE_END 'E'
+#define C3_TRACE_MARK 'i'
+/** @brief Starts at the time stamp and lasts arg cycles */
+#define C3_TRACE_SPAN 'X'
+
+/** @brief Categories for c3TraceStart */
+#define C3_TRACE_CAT_LINES 0x01		// Every line the interrupt sends
+#define C3_TRACE_CAT_FRAME 0x02		// Field ends, buffer swaps, frame callback, command ring
+#define C3_TRACE_CAT_USER 0x04		// C3_TR_USER events of the sketch
+#define C3_TRACE_CAT_ALL 0xff
+
+// --- Typedefs ---
+typedef enum {
+	C3_TR_LINE = 0,		// + line type (FT_xxx_d), span of the interrupt
+	C3_TR_FIELD = 16,	// Last line of a field sent, arg is the frame number
+	C3_TR_SWAP,			// Front and back buffer exchanged
+	C3_TR_DRAIN,		// Command ring drained
+	C3_TR_RENDER,		// Frame callback
+	C3_TR_USER = 32,	// + 0..223 for the sketch
+} c3TraceId_t;
+
+typedef struct {
+	uint32_t ccount;	// CPU cycle counter
+	uint8_t id;			// c3TraceId_t
+	uint8_t phase;		// C3_TRACE_xxx
+	uint16_t arg;
+} c3TraceEvent_t;
+
+// --- Macros ---
+#if C3_TRACE
+extern c3TraceEvent_t c3TraceRing[C3_TRACE_EVENTS];
+extern volatile uint32_t c3TraceHead;
+extern volatile uint8_t c3TraceMask;
+
+/**
+ * @brief Records an event, from the video interrupt. The interrupt is not interrupted by the other
+ * recorders, so it needs no locking.
+ */
+static inline void c3TraceAt( uint8_t cat, uint32_t ccount, uint8_t id, uint8_t phase, uint16_t arg ){
+	if(!(c3TraceMask & cat)) return;
+	c3TraceEvent_t *e = &c3TraceRing[c3TraceHead & (C3_TRACE_EVENTS-1)];
+	e->ccount = ccount;
+	e->id = id;
+	e->phase = phase;
+	e->arg = arg;
+	c3TraceHead++;
+}
+
+/**
+ * @brief Records an event now, outside the video interrupt
+ */
+static inline void c3TraceNow( uint8_t cat, uint8_t id, uint8_t phase, uint16_t arg ){
+	if(!(c3TraceMask & cat)) return;
+	uint32_t ps = xt_rsil(15);
+	c3TraceAt(cat, ESP.getCycleCount(), id, phase, arg);
+	xt_wsr_ps(ps);
+}
+
+#define C3_TRACE_ISR(cat, ccount, id, phase, arg) c3TraceAt((cat), (ccount), (id), (phase), (arg))
+#define C3_TRACE_EVENT(cat, id, phase, arg) c3TraceNow((cat), (id), (phase), (arg))
+#else
+#define C3_TRACE_ISR(cat, ccount, id, phase, arg) do {} while(0)
+#define C3_TRACE_EVENT(cat, id, phase, arg) do {} while(0)
+#endif
+
+/** @brief Marks for the sketch, n is 0..223 */
+#define C3_TRACE_USER_BEGIN(n, arg) C3_TRACE_EVENT(C3_TRACE_CAT_USER, C3_TR_USER + (n), C3_TRACE_BEGIN, (arg))
+#define C3_TRACE_USER_END(n, arg) C3_TRACE_EVENT(C3_TRACE_CAT_USER, C3_TR_USER + (n), C3_TRACE_END, (arg))
+#define C3_TRACE_USER_MARK(n, arg) C3_TRACE_EVENT(C3_TRACE_CAT_USER, C3_TR_USER + (n), C3_TRACE_MARK, (arg))
+
+// --- Public Functions ---
+/**
+ * @brief Empties the ring and records the categories given. The oldest events are overwritten once
+ * it is full, so it always holds the last C3_TRACE_EVENTS. Does nothing without C3_TRACE.
+ *
+ * @param categories C3_TRACE_CAT_xxx
+ */
+void c3TraceStart( uint8_t categories );
+/**
+ * @brief Stops recording, e.g. right after something went wrong
+ */
+void c3TraceStop();
+/**
+ * @brief Stops recording and prints the events, oldest first, for tools/c3trace2json.py
+ *
+ * @param out e.g. &Serial
+ * @return uint16_t Events printed
+ */
+uint16_t c3TraceDump( Print *out );
+
+#endif /* ESP8266CHANNEL3TRACE_H */
@@ -48,11 +48,14 @@ Extra copyright info:
 #include <i2s_reg.h>
 #include "CbTable.h" 
 #include "dmastuff.h"
+#include "trace.h"
 
 // I2S Config
 #define FUNC_I2SO_DATA                      1
+#ifndef WS_I2S_BCK	// A generated broadcast_tables.h brings the clock it was made for
 #define WS_I2S_BCK 1  //Can't be less than 1.
 #define WS_I2S_DIV 2
+#endif
 
 //Framebuffer width/height
 #define FBW 232 //Must be divisible by 8.  These are actually "double-pixels" used for double-resolution monochrome width.
@@ -78,6 +81,22 @@ Extra copyright info:
 #define LINE_SIGNAL_INTERVAL_NTSC 147
 #define COLORBURST_INTERVAL_NTSC 4
 
+/** @brief Words of a DMA buffer, every buffer has room for a line of either standard */
+#define LINE_BUFFER_LENGTH_MAX ((LINE_BUFFER_LENGTH_PAL > LINE_BUFFER_LENGTH_NTSC)?LINE_BUFFER_LENGTH_PAL:LINE_BUFFER_LENGTH_NTSC)
+/** @brief Bytes of all DMA buffers */
+#define I2S_BD_BYTES (sizeof(uint32_t)*LINE_BUFFER_LENGTH_MAX*DMABUFFERDEPTH)
+#if C3_ARENA_DMA_BYTES != 4*LINE_BUFFER_LENGTH_MAX*DMABUFFERDEPTH || C3_ARENA_FB_BYTES_NTSC != 2*(FBW/4)*FBH_NTSC || C3_ARENA_FB_BYTES_PAL != 2*(FBW/4)*FBH_PAL
+#error "C3_ARENA_xxx in video_broadcast.h do not match the line and framebuffer sizes"
+#endif
+
+/** @brief Rounds up to whole words */
+#define ALIGN4(n) (((n)+3) & ~3)
+
+/** @brief Bytes of a packed 1bpp line */
+#define FB_MONO_STRIDE (FBW/8)
+/** @brief Flag in fb_row_offset */
+#define FB_ROW_MONO 0x8000
+
 /** @brief writes COLOR to the DMA buffer at the next position */
 #define WRITE_TO_DMA(COLOR) *(dma_cursor++) = tablept[(COLOR)]; tablept += PREMOD_SIZE;
 
@@ -86,8 +105,10 @@ Extra copyright info:
 //Each NTSC line = 15,734.264 Hz.  63556 ns
 //Each group of 4 bytes = 
 
+#if !C3_HOST
 //I2S DMA buffer descriptors
 static struct sdio_queue i2sBufDesc[DMABUFFERDEPTH];
+#endif
 uint32_t *i2sBD;
 
 /** @brief current line number being displayed */
@@ -109,6 +130,27 @@ LOCAL uint8_t normalSyncInterval;
 LOCAL uint8_t lineSignalInterval;
 LOCAL uint8_t colorburstInterval;
 
+/** @brief Timing of one video standard */
+typedef struct {
+	uint8_t lineBufferLen;
+	uint8_t shortSyncInterval;
+	uint8_t longSyncInterval;
+	uint8_t normalSyncInterval;
+	uint8_t lineSignalInterval;
+	uint8_t colorburstInterval;
+	uint16_t fbLines;			// Framebuffer lines of C3_FB_STANDARD
+	uint16_t fieldLines;		// Signal lines of the first field
+	uint8_t *lineCbLookup;
+} videoTiming_t;
+
+/** @brief Indexed by channel3VideoType_t */
+LOCAL const videoTiming_t videoTimings[2] = {
+	{ LINE_BUFFER_LENGTH_NTSC, SHORT_SYNC_INTERVAL_NTSC, LONG_SYNC_INTERVAL_NTSC, NORMAL_SYNC_INTERVAL_NTSC,
+		LINE_SIGNAL_INTERVAL_NTSC, COLORBURST_INTERVAL_NTSC, FBH_NTSC, VIDEO_LINES_NTSC/2, CbLookupNTSC },
+	{ LINE_BUFFER_LENGTH_PAL, SHORT_SYNC_INTERVAL_PAL, LONG_SYNC_INTERVAL_PAL, NORMAL_SYNC_INTERVAL_PAL,
+		LINE_SIGNAL_INTERVAL_PAL, COLORBURST_INTERVAL_PAL, FBH_PAL, VIDEO_LINES_PAL/2, CbLookupPAL },
+};
+
 const uint32_t *tablestart = &premodulated_table[0];
 const uint32_t *tablept = &premodulated_table[0];
 const uint32_t *tableend = &premodulated_table[PREMOD_ENTRIES*PREMOD_SIZE];
@@ -119,6 +161,120 @@ LOCAL uint16_t fb_line_number;
 
 /** @brief PAL or NTSC */
 LOCAL channel3VideoType_t videoStandard;
+/** @brief Layout of the framebuffer */
+LOCAL channel3FramebufferMode_t fb_mode;
+/** @brief Bytes per framebuffer line */
+LOCAL uint16_t fb_stride;
+/** @brief Bytes of one frame */
+LOCAL uint16_t fb_frame_bytes;
+/** @brief C3_FB_MIXED: byte offset of every line in a frame, | FB_ROW_MONO for packed 1bpp lines */
+LOCAL uint16_t *fb_row_offset = NULL;
+/** @brief C3_FB_MIXED: line modes for the next init */
+LOCAL const uint8_t *next_line_modes = NULL;
+LOCAL uint16_t next_line_mode_count;
+/** @brief C3_FB_STRIP: fills the lines ahead of the beam */
+LOCAL videoLineRenderer_t line_renderer = NULL;
+/** @brief C3_FB_STRIP: next line to render into the ring */
+LOCAL uint16_t strip_next;
+/** @brief RAM copy of premodulated_ext_table, the interrupt must not wait for the flash cache */
+LOCAL uint32_t *ext_table = NULL;
+
+/** @brief C3_FB_INTERLACED or held: image being sent and image being drawn, the same without a back buffer */
+LOCAL uint16_t *fb_front;
+LOCAL uint16_t *fb_back;
+/** @brief Exchange fb_front and fb_back after this frame */
+LOCAL volatile uint8_t fb_swap_pending;
+/** @brief Two frame modes: send fb_front until video_broadcast_present instead of alternating every frame */
+LOCAL uint8_t fb_hold;
+/** @brief Frame the drawing functions go to instead of following the frame number, see video_broadcast_pin_frame */
+LOCAL uint8_t *fb_pinned;
+/** @brief Signal lines of the first field */
+LOCAL uint16_t field_lines;
+
+/** @brief Most CPU cycles one line callback took */
+LOCAL uint32_t line_cycles_max;
+
+/** @brief fb_height and fb_frame_bytes of the current mode in either standard */
+LOCAL uint16_t fb_height_std[2];
+LOCAL uint16_t fb_frame_bytes_std[2];
+/** @brief Bytes of framebuffer and entries of fb_row_offset allocated */
+LOCAL uint32_t fb_alloc_bytes;
+LOCAL uint16_t fb_alloc_rows;
+/** @brief Allocate for the larger standard in the next init */
+LOCAL uint8_t reserve_both;
+/** @brief Standard to change to at the end of the frame */
+LOCAL volatile uint8_t switch_pending;
+LOCAL channel3VideoType_t switch_to;
+LOCAL uint32_t switch_start;
+LOCAL uint32_t switch_cycles;
+/** @brief DMA descriptors still to be set to the line length of the new standard */
+LOCAL uint8_t desc_resize;
+
+/** @brief Sizes of a framebuffer layout in both standards */
+typedef struct {
+	uint16_t stride;			// Bytes per line
+	uint16_t height[2];
+	uint16_t frameBytes[2];
+	uint16_t rows;				// C3_FB_MIXED: entries of fb_row_offset
+	uint32_t fbBytes;			// Framebuffer to allocate
+} fbLayout_t;
+
+#if C3_STATIC_ARENA
+/** @brief Arena sized at compile time, used unless video_broadcast_set_arena gives another one */
+LOCAL uint32_t static_arena[(C3_STATIC_ARENA+3)/4];
+LOCAL uint8_t *arena_base = (uint8_t*)static_arena;
+LOCAL uint32_t arena_size = sizeof(static_arena);
+#else
+/** @brief Memory the engine allocates from, NULL for malloc */
+LOCAL uint8_t *arena_base = NULL;
+LOCAL uint32_t arena_size = 0;
+#endif
+LOCAL uint32_t arena_used;
+/** @brief The buffers of the last init came from the arena and are not freed */
+LOCAL uint8_t from_arena;
+
+/** @brief Frame the lines are sent from in the modes with two frames */
+LOCAL inline uint8_t *sent_frame()
+{
+	if(fb_hold) return (uint8_t*)fb_front;
+	return (uint8_t*)framebuffer + (frame_number & 1)*fb_frame_bytes;
+}
+
+/** @brief Takes over the line timing and line types of a standard */
+LOCAL void set_timing(channel3VideoType_t videoType)
+{
+	const videoTiming_t *t = &videoTimings[videoType];
+	lineBufferLen = t->lineBufferLen;
+	shortSyncInterval = t->shortSyncInterval;
+	longSyncInterval = t->longSyncInterval;
+	normalSyncInterval = t->normalSyncInterval;
+	lineSignalInterval = t->lineSignalInterval;
+	colorburstInterval = t->colorburstInterval;
+	lineCbLookupTable = t->lineCbLookup;
+	field_lines = t->fieldLines;
+}
+
+/**
+ * @brief Changes the standard at the end of a frame, from the interrupt. Everything it needs was
+ * sized during init, the lines already queued for DMA keep their length.
+ */
+LOCAL void switch_standard()
+{
+	videoStandard = switch_to;
+	set_timing(videoStandard);
+	fb_height = fb_height_std[videoStandard];
+	fb_frame_bytes = fb_frame_bytes_std[videoStandard];
+	if(fb_hold && fb_mode != C3_FB_INTERLACED){
+		// The second frame starts after the first one, which changed size
+		uint16_t *second = (uint16_t*)((uint8_t*)framebuffer + fb_frame_bytes);
+		if(fb_front == framebuffer) fb_back = second;
+		else fb_front = second;
+	}
+	desc_resize = DMABUFFERDEPTH + 1;
+	switch_cycles = ESP.getCycleCount() - switch_start;
+	if(switch_cycles == 0) switch_cycles = 1;
+	switch_pending = 0;
+}
 
 //Each "qty" is 32 bits, or .4us
 LOCAL void fillwith( uint16_t qty, uint8_t color )
@@ -214,42 +370,215 @@ LOCAL void FT_LIN()
 	fillwith( colorburstInterval, COLORBURST_LEVEL );
 	fillwith( 11, BLACK_LEVEL );
 
-	int fframe = frame_number & 1; 
 	uint16_t *fb_line;
-	if(frame_number & 1){ // Even / Odd frame
-		fb_line = (uint16_t*)(&framebuffer[ 
-		( 
-			(fb_line_number * (FBW2/2)) + 
-			((FBW2/2)*(fb_height))
-		) / 2]);
+	int fb_row = fb_line_number;
+	if(fb_mode == C3_FB_INTERLACED){
+		// Both fields come out of one image, the second field sends the odd lines
+		int field = (signal_line_number >= field_lines) ^ C3_INTERLACE_SWAP_FIELDS;
+		fb_row = (fb_line_number<<1) + field;
+		fb_line = &fb_front[fb_row * (FBW2/4)];
+	} else { // Even / Odd frame
+		fb_line = (uint16_t*)(sent_frame() + fb_line_number*(FBW2/2));
+	}
+
+	// A PAL field has one signal line more than the framebuffer
+	if(fb_row >= fb_height){
+		fillwith( FBW2, BLACK_LEVEL );
 	} else {
-		fb_line = (uint16_t*)(&framebuffer[ 
-		( 
-			(fb_line_number * (FBW2/2))
-		) / 2]);
+		// Drawing video data
+		// Each line is divided into FBW2/4 = 232/8 = 29 Blocks. 
+		for(int line_block_i = 0; line_block_i < FBW2/4; line_block_i++ )
+		{
+			uint16_t line_block = fb_line[line_block_i];
+			// Each line block is contains
+			//  - 8 B/W pixels or
+			//  - 4 color pixels
+
+			WRITE_TO_DMA((line_block>>0)&0x0F);
+			WRITE_TO_DMA((line_block>>4)&0x0F);
+			WRITE_TO_DMA((line_block>>8)&0x0F);
+			WRITE_TO_DMA((line_block>>12)&0x0F);
+			if( tablept >= tableend ) tablept = tablept - tableend + tablestart;
+		}
 	}
 
-	// Drawing video data
-	// Each line is divided into FBW2/4 = 232/8 = 29 Blocks. 
+	// Back porch / HBlank
+	fillwith( lineBufferLen - (normalSyncInterval+1+colorburstInterval+11+FBW2), BLACK_LEVEL);
+
+	fb_line_number++;
+}
+/** @brief Two 1bpp pixels (LSB is the left one) as a double density nibble */
+LOCAL const uint8_t monoToDD[4] = { 0, 2, 8, 10 };
+/** @brief Writes a packed 1bpp line as double density pixels, 8 pixels per byte, 2 per table word */
+LOCAL inline void write_mono_line(const uint8_t *fb_row)
+{
+	for(int line_block_i = 0; line_block_i < FB_MONO_STRIDE; line_block_i++ )
+	{
+		uint8_t line_block = fb_row[line_block_i];
+		WRITE_TO_DMA(monoToDD[(line_block>>0)&0x03]);
+		WRITE_TO_DMA(monoToDD[(line_block>>2)&0x03]);
+		WRITE_TO_DMA(monoToDD[(line_block>>4)&0x03]);
+		WRITE_TO_DMA(monoToDD[(line_block>>6)&0x03]);
+		if( tablept >= tableend ) tablept = tablept - tableend + tablestart;
+	}
+}
+/** @brief Writes a 4bpp / double density line, 4 pixels per halfword */
+LOCAL inline void write_color_line(const uint16_t *fb_line)
+{
 	for(int line_block_i = 0; line_block_i < FBW2/4; line_block_i++ )
 	{
 		uint16_t line_block = fb_line[line_block_i];
-		// Each line block is contains
-		//  - 8 B/W pixels or
-		//  - 4 color pixels
-
 		WRITE_TO_DMA((line_block>>0)&0x0F);
 		WRITE_TO_DMA((line_block>>4)&0x0F);
 		WRITE_TO_DMA((line_block>>8)&0x0F);
 		WRITE_TO_DMA((line_block>>12)&0x0F);
 		if( tablept >= tableend ) tablept = tablept - tableend + tablestart;
 	}
+}
+/**
+ * @brief C3_FB_STRIP: renders up to C3_STRIP_AHEAD lines into ring slots that were already sent
+ */
+LOCAL void strip_render_ahead()
+{
+	if(line_renderer == NULL) return;
+	for(int i = 0; i < C3_STRIP_AHEAD; i++){
+		if(strip_next >= fb_height || strip_next >= fb_line_number + C3_STRIP_LINES) return;
+		line_renderer(strip_next, &framebuffer[(strip_next % C3_STRIP_LINES)*(FBW2/4)]);
+		strip_next++;
+	}
+}
+/** @brief Short Sync cb for C3_FB_STRIP, a new field starts rendering from the top */
+LOCAL void FT_STA_STRIP()
+{
+	FT_STA();
+	strip_next = 0;
+}
+/** @brief Black cb for C3_FB_STRIP, the first lines are rendered during the vertical blank */
+LOCAL void FT_B_STRIP()
+{
+	FT_B();
+	strip_render_ahead();
+}
+/** @brief Line Signal cb for C3_FB_STRIP, sends a line of the ring and renders the next ones */
+LOCAL void FT_LIN_STRIP()
+{
+	// Front porch / HBlank
+	fillwith( normalSyncInterval, SYNC_LEVEL );
+	fillwith( 1, BLACK_LEVEL );
+	fillwith( colorburstInterval, COLORBURST_LEVEL );
+	fillwith( 11, BLACK_LEVEL );
+
+	// Lines the renderer did not get to in time are black
+	if(fb_line_number >= strip_next){
+		fillwith( FBW2, BLACK_LEVEL );
+	} else {
+		write_color_line(&framebuffer[(fb_line_number % C3_STRIP_LINES)*(FBW2/4)]);
+	}
 
 	// Back porch / HBlank
 	fillwith( lineBufferLen - (normalSyncInterval+1+colorburstInterval+11+FBW2), BLACK_LEVEL);
 
 	fb_line_number++;
+	strip_render_ahead();
 }
+/** @brief Line Signal cb for C3_FB_MONO */
+LOCAL void FT_LIN_MONO()
+{
+	// Front porch / HBlank
+	fillwith( normalSyncInterval, SYNC_LEVEL );
+	fillwith( 1, BLACK_LEVEL );
+	fillwith( colorburstInterval, COLORBURST_LEVEL );
+	fillwith( 11, BLACK_LEVEL );
+
+	if(fb_line_number >= fb_height){
+		fillwith( FBW2, BLACK_LEVEL );
+	} else {
+		write_mono_line(sent_frame() + fb_line_number*FB_MONO_STRIDE);
+	}
+
+	// Back porch / HBlank
+	fillwith( lineBufferLen - (normalSyncInterval+1+colorburstInterval+11+FBW2), BLACK_LEVEL);
+
+	fb_line_number++;
+}
+/** @brief Line Signal cb for C3_FB_MIXED, lines are either 4bpp like FT_LIN or packed 1bpp */
+LOCAL void FT_LIN_MIXED()
+{
+	// Front porch / HBlank
+	fillwith( normalSyncInterval, SYNC_LEVEL );
+	fillwith( 1, BLACK_LEVEL );
+	fillwith( colorburstInterval, COLORBURST_LEVEL );
+	fillwith( 11, BLACK_LEVEL );
+
+	if(fb_line_number >= fb_height){
+		fillwith( FBW2, BLACK_LEVEL );
+	} else {
+		uint16_t offset = fb_row_offset[fb_line_number];
+		uint8_t *fb_row = sent_frame() + (offset & ~FB_ROW_MONO);
+		if(offset & FB_ROW_MONO){
+			write_mono_line(fb_row);
+		} else {
+			write_color_line((uint16_t*)fb_row);
+		}
+	}
+
+	// Back porch / HBlank
+	fillwith( lineBufferLen - (normalSyncInterval+1+colorburstInterval+11+FBW2), BLACK_LEVEL);
+
+	fb_line_number++;
+}
+/** @brief Line Signal cb for C3_FB_EXT64, one byte per pixel and every framebuffer line shown twice */
+LOCAL void FT_LIN_EXT()
+{
+	// Front porch / HBlank
+	fillwith( normalSyncInterval, SYNC_LEVEL );
+	fillwith( 1, BLACK_LEVEL );
+	fillwith( colorburstInterval, COLORBURST_LEVEL );
+	fillwith( 11, BLACK_LEVEL );
+
+	int fb_row = fb_line_number>>1;
+	if(fb_row >= fb_height){
+		fillwith( FBW2, BLACK_LEVEL );
+	} else {
+		const uint32_t *fb_line = (const uint32_t*)(sent_frame() + fb_row*FBW2);
+		// Continue at the same carrier phase in the 64 color table
+		const uint32_t *extpt = &ext_table[((tablept - tablestart)/PREMOD_SIZE)*PREMOD_EXT_SIZE];
+		const uint32_t *extend = &ext_table[PREMOD_ENTRIES*PREMOD_EXT_SIZE];
+
+		// 4 pixels per word, the top two bits of each byte are ignored
+		for(int line_block_i = 0; line_block_i < FBW2/4; line_block_i++ )
+		{
+			uint32_t line_block = fb_line[line_block_i];
+			*(dma_cursor++) = extpt[(line_block>>0)&0x3F]; extpt += PREMOD_EXT_SIZE;
+			*(dma_cursor++) = extpt[(line_block>>8)&0x3F]; extpt += PREMOD_EXT_SIZE;
+			*(dma_cursor++) = extpt[(line_block>>16)&0x3F]; extpt += PREMOD_EXT_SIZE;
+			*(dma_cursor++) = extpt[(line_block>>24)&0x3F]; extpt += PREMOD_EXT_SIZE;
+			if( extpt >= extend ) extpt = extpt - extend + ext_table;
+		}
+		tablept = tablestart + ((extpt - ext_table)/PREMOD_EXT_SIZE)*PREMOD_SIZE;
+	}
+
+	// Back porch / HBlank
+	fillwith( lineBufferLen - (normalSyncInterval+1+colorburstInterval+11+FBW2), BLACK_LEVEL);
+
+	fb_line_number++;
+}
+/** @brief Swaps a presented frame and starts the next field */
+LOCAL inline void end_field()
+{
+	if(fb_swap_pending){
+		uint16_t *t = fb_front;
+		fb_front = fb_back;
+		fb_back = t;
+		fb_swap_pending = 0;
+		C3_TRACE_ISR(C3_TRACE_CAT_FRAME, ESP.getCycleCount(), C3_TR_SWAP, C3_TRACE_MARK, 0);
+	}
+	signal_line_number = -1;
+	frame_number++;
+	C3_TRACE_ISR(C3_TRACE_CAT_FRAME, ESP.getCycleCount(), C3_TR_FIELD, C3_TRACE_MARK, frame_number);
+	if(switch_pending) switch_standard();
+}
+
 /** @brief End Frame cb */
 LOCAL void FT_CLOSE_M()
 {
@@ -264,15 +593,15 @@ LOCAL void FT_CLOSE_M()
 		fillwith( 4, COLORBURST_LEVEL );
 		fillwith( lineBufferLen-normalSyncInterval-6, WHITE_LEVEL );
 	}
-	signal_line_number = -1;
-	frame_number++;
+	end_field();
 }
 
 /** @brief Line type callback table */
 void (*lineCbTable[FT_MAX_d])() = { FT_STA, FT_STB, FT_B, FT_SRA, FT_SRB, FT_LIN, FT_CLOSE_M };
 
+#if !C3_HOST
 /** @brief I2S DMA interrupt handler */
-LOCAL void slc_isr(void *unused1, void *unused2) {
+LOCAL void slc_isr(void *, void *) {
 	struct sdio_queue *finishedDesc;
 	uint32 slc_intr_status;
 
@@ -291,40 +620,166 @@ LOCAL void slc_isr(void *unused1, void *unused2) {
 			else // Even frame
 				currentLineType = lineCbLookupTable[signal_line_number>>1]&0x0f;
 
+			uint8_t len = lineBufferLen;
+			uint32_t start = ESP.getCycleCount();
 			lineCbTable[currentLineType]();
+			uint32_t spent = ESP.getCycleCount() - start;
+			if(desc_resize){
+				// The standard changed, the buffer goes out again with the length it was filled with
+				finishedDesc->datalen = len*4;
+				finishedDesc->blocksize = len*4;
+				desc_resize--;
+			}
+			if(spent > line_cycles_max) line_cycles_max = spent;
+			C3_TRACE_ISR(C3_TRACE_CAT_LINES, start, C3_TR_LINE + currentLineType, C3_TRACE_SPAN, (spent > 0xffff)?0xffff:spent);
 			signal_line_number++;
 		}
 		
 	}
 }
+#endif
+
+uint8_t ICACHE_FLASH_ATTR video_broadcast_init(channel3VideoType_t videoType) {
+	return video_broadcast_init_mode(videoType, C3_FB_STANDARD);
+}
+
+/**
+ * @brief Works out the sizes of a framebuffer layout in both standards, without touching the broadcast
+ * 
+ * @param row_offset C3_FB_MIXED: filled with the offset of every line, NULL to only size them
+ */
+LOCAL void ICACHE_FLASH_ATTR plan_layout(channel3VideoType_t videoType, channel3FramebufferMode_t mode, fbLayout_t *l, uint16_t *row_offset)
+{
+	if(mode == C3_FB_EXT64) l->stride = FBW2;
+	else if(mode == C3_FB_MONO) l->stride = FB_MONO_STRIDE;
+	else l->stride = FBW/4;
+	for(int i = 0; i < 2; i++){
+		l->height[i] = videoTimings[i].fbLines;
+		if(mode == C3_FB_EXT64) l->height[i] /= 2;
+		if(mode == C3_FB_INTERLACED) l->height[i] *= 2;
+		if(mode == C3_FB_STRIP) l->frameBytes[i] = l->stride*C3_STRIP_LINES;
+		else l->frameBytes[i] = l->stride*l->height[i];
+	}
+	// Allocated for the larger standard if asked to
+	l->rows = l->height[videoType];
+	if(reserve_both) l->rows = (l->height[NTSC] > l->height[PAL])?l->height[NTSC]:l->height[PAL];
+
+	if(mode == C3_FB_MIXED){
+		// Lay out the lines, 4bpp lines stay halfword aligned. The lines of the smaller standard are the first ones of the larger.
+		uint16_t offset = 0;
+		for(int i = 0; i < l->rows; i++){
+			uint16_t row;
+			if(i < next_line_mode_count && next_line_modes[i] == C3_LINE_MONO){
+				row = offset | FB_ROW_MONO;
+				offset += FB_MONO_STRIDE;
+			} else {
+				offset = (offset+1) & ~1;
+				row = offset;
+				offset += l->stride;
+			}
+			if(row_offset != NULL) row_offset[i] = row;
+			for(int s = 0; s < 2; s++){
+				if(i == l->height[s]-1) l->frameBytes[s] = (offset+3) & ~3;
+			}
+		}
+	} else {
+		l->rows = 0;
+	}
+
+	// Interlaced is one image with both fields, strip is a ring of lines, the others hold two frames.
+	l->fbBytes = l->frameBytes[videoType];
+	if(reserve_both){
+		for(int i = 0; i < 2; i++){
+			if(l->frameBytes[i] > l->fbBytes) l->fbBytes = l->frameBytes[i];
+		}
+	}
+	if(mode != C3_FB_INTERLACED && mode != C3_FB_STRIP) l->fbBytes *= 2;
+}
+
+/** @brief Memory of the engine, from the arena if one is set */
+LOCAL void * ICACHE_FLASH_ATTR engine_alloc(uint32_t bytes)
+{
+	bytes = ALIGN4(bytes);
+	if(arena_base == NULL) return malloc(bytes);
+	if(arena_used + bytes > arena_size) return NULL;
+	void *p = arena_base + arena_used;
+	arena_used += bytes;
+	return p;
+}
+
+LOCAL void engine_free(void *p)
+{
+	if(!from_arena) free(p);
+}
 
 //Initialize I2S subsystem for DMA circular buffer use
-void ICACHE_FLASH_ATTR video_broadcast_init(channel3VideoType_t videoType) {
+uint8_t ICACHE_FLASH_ATTR video_broadcast_init_mode(channel3VideoType_t videoType, channel3FramebufferMode_t mode) {
+	fbLayout_t layout;
+	plan_layout(videoType, mode, &layout, NULL);
+
+	// Take all memory first, nothing is changed if that fails
+	arena_used = 0;
+	from_arena = (arena_base != NULL);
+	uint16_t *fb = (uint16_t *) engine_alloc(layout.fbBytes);
+	uint32_t *bd = (uint32_t *) engine_alloc(I2S_BD_BYTES);
+	uint32_t *ext = (mode == C3_FB_EXT64)?(uint32_t *) engine_alloc(sizeof(premodulated_ext_table)):NULL;
+	uint16_t *rows = (mode == C3_FB_MIXED)?(uint16_t *) engine_alloc(sizeof(uint16_t)*layout.rows):NULL;
+	if(fb == NULL || bd == NULL || (mode == C3_FB_EXT64 && ext == NULL) || (mode == C3_FB_MIXED && rows == NULL)){
+		engine_free(fb);
+		engine_free(bd);
+		engine_free(ext);
+		engine_free(rows);
+		return 0;
+	}
+
 	videoStandard = videoType;
+	fb_mode = mode;
+	switch_pending = 0;
+	switch_cycles = 0;
+	desc_resize = 0;
 	// Populate various constants based on video standard
-	if(videoStandard == PAL){
-		lineBufferLen = LINE_BUFFER_LENGTH_PAL;
-		shortSyncInterval = SHORT_SYNC_INTERVAL_PAL;
-		longSyncInterval = LONG_SYNC_INTERVAL_PAL;
-		normalSyncInterval = NORMAL_SYNC_INTERVAL_PAL;
-		lineSignalInterval = LINE_SIGNAL_INTERVAL_PAL;
-		colorburstInterval = COLORBURST_INTERVAL_PAL;
-		fb_height = FBH_PAL;
-		lineCbLookupTable = CbLookupPAL;
+	set_timing(videoStandard);
+	fb_stride = layout.stride;
+	for(int i = 0; i < 2; i++){
+		fb_height_std[i] = layout.height[i];
+		fb_frame_bytes_std[i] = layout.frameBytes[i];
+	}
+	fb_height = fb_height_std[videoStandard];
+	fb_frame_bytes = fb_frame_bytes_std[videoStandard];
+	fb_alloc_bytes = layout.fbBytes;
+	fb_alloc_rows = layout.rows;
+
+	// Pick the line renderer for the framebuffer layout
+	if(fb_mode == C3_FB_EXT64){
+		ext_table = ext;
+		memcpy_P(ext_table, premodulated_ext_table, sizeof(premodulated_ext_table));
+		lineCbTable[FT_LIN_d] = FT_LIN_EXT;
+	} else if(fb_mode == C3_FB_MIXED){
+		fb_row_offset = rows;
+		plan_layout(videoType, mode, &layout, fb_row_offset);
+		lineCbTable[FT_LIN_d] = FT_LIN_MIXED;
+	} else if(fb_mode == C3_FB_MONO){
+		lineCbTable[FT_LIN_d] = FT_LIN_MONO;
+	} else if(fb_mode == C3_FB_STRIP){
+		strip_next = 0;
+		lineCbTable[FT_LIN_d] = FT_LIN_STRIP;
 	} else {
-		lineBufferLen = LINE_BUFFER_LENGTH_NTSC;
-		shortSyncInterval = SHORT_SYNC_INTERVAL_NTSC;
-		longSyncInterval = LONG_SYNC_INTERVAL_NTSC;
-		normalSyncInterval = NORMAL_SYNC_INTERVAL_NTSC;
-		lineSignalInterval = LINE_SIGNAL_INTERVAL_NTSC;
-		colorburstInterval = COLORBURST_INTERVAL_NTSC;
-		fb_height = FBH_NTSC;
-		lineCbLookupTable = CbLookupNTSC;
+		lineCbTable[FT_LIN_d] = FT_LIN;
 	}
+	lineCbTable[FT_STA_d] = (fb_mode == C3_FB_STRIP)?FT_STA_STRIP:FT_STA;
+	lineCbTable[FT_B_d] = (fb_mode == C3_FB_STRIP)?FT_B_STRIP:FT_B;
+	line_cycles_max = 0;
+
+	framebuffer = fb;
+	fb_front = framebuffer;
+	fb_back = framebuffer;
+	fb_swap_pending = 0;
+	fb_hold = 0;
+	fb_pinned = NULL;
+	i2sBD = bd;
 
-	// Create dynamic data
-	framebuffer = (uint16_t *) malloc(sizeof(uint16_t) * ( (FBW2/4)*fb_height ) *2);
-	i2sBD = (uint32_t *) malloc(sizeof(uint32_t) * (lineBufferLen*DMABUFFERDEPTH));
+#if !C3_HOST
+	//The descriptors hold 32 bit addresses, the host builds (tools/host) have no DMA to set up
 
 	//Initialize DMA buffer descriptors in such a way that they will form a circular
 	//buffer.
@@ -334,7 +789,7 @@ void ICACHE_FLASH_ATTR video_broadcast_init(channel3VideoType_t videoType) {
 		i2sBufDesc[x].sub_sof=0;
 		i2sBufDesc[x].datalen=lineBufferLen*4;
 		i2sBufDesc[x].blocksize=lineBufferLen*4;
-		i2sBufDesc[x].buf_ptr=(uint32_t)&i2sBD[x*lineBufferLen];
+		i2sBufDesc[x].buf_ptr=(uint32_t)&i2sBD[x*LINE_BUFFER_LENGTH_MAX];
 		i2sBufDesc[x].unused=0;
 		i2sBufDesc[x].next_link_ptr=(int)((x<(DMABUFFERDEPTH-1))?(&i2sBufDesc[x+1]):(&i2sBufDesc[0]));
 	}
@@ -365,6 +820,7 @@ void ICACHE_FLASH_ATTR video_broadcast_init(channel3VideoType_t videoType) {
 
 	//Attach the DMA interrupt
 	ets_isr_attach(ETS_SLC_INUM, slc_isr, NULL);
+#endif
 	//Enable DMA operation intr
 	WRITE_PERI_REG(SLC_INT_ENA,  SLC_RX_EOF_INT_ENA);
 	//clear any interrupt flags that are set
@@ -423,6 +879,7 @@ void ICACHE_FLASH_ATTR video_broadcast_init(channel3VideoType_t videoType) {
 
 	//Start transmission
 	SET_PERI_REG_MASK(I2SCONF,I2S_I2S_TX_START);
+	return 1;
 }
 
 
@@ -446,10 +903,86 @@ void video_broadcast_deinit() {
 	CLEAR_PERI_REG_MASK(SLC_CONF0, SLC_RXLINK_RST|SLC_TXLINK_RST);
 
 	// free dynamic data
-	free(framebuffer);
-	free(i2sBD);
+	switch_pending = 0;
+	engine_free(framebuffer);
+	framebuffer = NULL;
+	fb_front = NULL;
+	fb_back = NULL;
+	engine_free(ext_table);
+	ext_table = NULL;
+	engine_free(fb_row_offset);
+	fb_row_offset = NULL;
+	engine_free(i2sBD);
+	i2sBD = NULL;
+}
+
+void video_broadcast_set_arena(void *arena, uint32_t bytes){
+	if(arena == NULL){
+#if C3_STATIC_ARENA
+		arena_base = (uint8_t*)static_arena;
+		arena_size = sizeof(static_arena);
+#else
+		arena_base = NULL;
+		arena_size = 0;
+#endif
+		return;
+	}
+	// DMA buffers have to be word aligned
+	uint8_t *base = (uint8_t*)ALIGN4((uintptr_t)arena);
+	uint32_t skip = base - (uint8_t*)arena;
+	arena_base = base;
+	arena_size = (bytes > skip)?(bytes - skip) & ~3:0;
+}
+
+uint32_t video_broadcast_arena_bytes(channel3VideoType_t videoType, channel3FramebufferMode_t mode){
+	fbLayout_t layout;
+	plan_layout(videoType, mode, &layout, NULL);
+	uint32_t bytes = ALIGN4(layout.fbBytes) + ALIGN4(I2S_BD_BYTES);
+	if(mode == C3_FB_EXT64) bytes += ALIGN4(sizeof(premodulated_ext_table));
+	if(mode == C3_FB_MIXED) bytes += ALIGN4(sizeof(uint16_t)*layout.rows);
+	return bytes;
+}
+
+uint32_t video_broadcast_arena_used(){
+	return from_arena?arena_used:0;
+}
+
+
+void video_broadcast_reserve_standards(uint8_t reserve){
+	reserve_both = reserve;
+}
+
+uint8_t video_broadcast_set_standard(channel3VideoType_t videoType){
+	if(framebuffer == NULL) return 0;
+	if(videoType == videoStandard){
+		switch_pending = 0;
+		return 1;
+	}
+	uint32_t need = fb_frame_bytes_std[videoType];
+	if(fb_mode != C3_FB_INTERLACED && fb_mode != C3_FB_STRIP) need *= 2;
+	if(need > fb_alloc_bytes) return 0;
+	if(fb_mode == C3_FB_MIXED && fb_height_std[videoType] > fb_alloc_rows) return 0;
+	// A back buffer of the caller only fits the frame size it was made for
+	if(fb_mode == C3_FB_INTERLACED && fb_back != fb_front && fb_frame_bytes_std[videoType] > fb_frame_bytes) return 0;
+	switch_pending = 0;
+	switch_to = videoType;
+	switch_cycles = 0;
+	switch_start = ESP.getCycleCount();
+	switch_pending = 1;
+	return 1;
+}
+
+uint8_t video_broadcast_standard_pending(){
+	return switch_pending;
 }
 
+channel3VideoType_t video_broadcast_get_standard(){
+	return videoStandard;
+}
+
+uint32_t video_broadcast_switch_us(){
+	return switch_cycles / system_get_cpu_freq();
+}
 
 uint16_t *video_broadcast_get_framebuffer(){
 	return framebuffer;
@@ -460,26 +993,104 @@ int video_broadcast_get_frame_number(){
 uint16_t video_broadcast_framebuffer_width(){
 	return FBW;
 }
-uint16_t video_broadcast_framebuffer_height(){
+uint16_t C3_PIXEL_ATTR video_broadcast_framebuffer_height(){
 	return fb_height;
 }
+channel3FramebufferMode_t video_broadcast_get_mode(){
+	return fb_mode;
+}
+uint32_t video_broadcast_line_cycles_max(uint8_t reset){
+	uint32_t cycles = line_cycles_max;
+	if(reset) line_cycles_max = 0;
+	return cycles;
+}
+uint32_t video_broadcast_line_cycles_budget(){
+	// One word is 32 bit clocks, the bit clock is 160MHz/(WS_I2S_BCK*WS_I2S_DIV)
+	return (lineBufferLen*32*WS_I2S_BCK*WS_I2S_DIV*system_get_cpu_freq())/160;
+}
 
-uint8_t * video_broadcast_get_frame(){
+uint32_t video_broadcast_frame_bytes(){
+	return fb_frame_bytes;
+}
+
+void video_broadcast_set_line_modes(const uint8_t *modes, uint16_t count){
+	next_line_modes = modes;
+	next_line_mode_count = (modes == NULL)?0:count;
+}
+
+channel3LineMode_t C3_PIXEL_ATTR video_broadcast_line_mode(int y){
+	if(fb_mode == C3_FB_MONO) return C3_LINE_MONO;
+	if(fb_mode == C3_FB_MIXED && y >= 0 && y < fb_height && (fb_row_offset[y] & FB_ROW_MONO)) return C3_LINE_MONO;
+	return C3_LINE_COLOR;
+}
+
+void video_broadcast_set_line_renderer(videoLineRenderer_t renderer){
+	line_renderer = renderer;
+}
+
+uint8_t * C3_PIXEL_ATTR video_broadcast_get_line(int y){
+	if(y < 0 || y >= fb_height || fb_mode == C3_FB_STRIP) return NULL;
+	if(fb_mode == C3_FB_MIXED) return video_broadcast_get_frame() + (fb_row_offset[y] & ~FB_ROW_MONO);
+	return video_broadcast_get_frame() + y*fb_stride;
+}
+
+void video_broadcast_set_back_buffer(uint8_t *buffer){
+	if(fb_mode != C3_FB_INTERLACED) return;
+	fb_swap_pending = 0;
+	fb_back = (buffer == NULL)?fb_front:(uint16_t*)buffer;
+}
+
+void video_broadcast_hold(uint8_t hold){
+	if(fb_mode == C3_FB_INTERLACED || fb_mode == C3_FB_STRIP) return;
+	// Keep sending what is on screen now, the other frame is drawn
+	fb_swap_pending = 0;
+	uint8_t *sent = sent_frame();
+	fb_front = (uint16_t*)sent;
+	fb_back = (uint16_t*)((sent == (uint8_t*)framebuffer)?sent + fb_frame_bytes:(uint8_t*)framebuffer);
+	fb_hold = hold;
+}
+
+void video_broadcast_present(){
+	if(fb_back != fb_front) fb_swap_pending = 1;
+}
+
+uint8_t video_broadcast_present_pending(){
+	return fb_swap_pending;
+}
+
+uint8_t * video_broadcast_get_sent_frame(){
+	if(fb_mode == C3_FB_INTERLACED) return (uint8_t*)fb_front;
+	return sent_frame();
+}
+
+uint8_t * C3_PIXEL_ATTR video_broadcast_get_frame(){
+	if(fb_pinned != NULL) return fb_pinned;
+	if(fb_mode == C3_FB_INTERLACED || fb_hold) return (uint8_t*)fb_back;
+	if(fb_mode == C3_FB_STRIP) return (uint8_t*)framebuffer;
+	// The frame sent next, drawing it does not race the beam
 	bool isOddFrame = frame_number&0x01;
-	if(!isOddFrame) return (uint8_t*)&framebuffer[0];
-	return (uint8_t*)&framebuffer[(FBW2/4) *fb_height];
+	if(isOddFrame) return (uint8_t*)framebuffer;
+	return (uint8_t*)framebuffer + fb_frame_bytes;
 }
 
+void video_broadcast_pin_frame(uint8_t *frame){
+	fb_pinned = frame;
+}
+
+#if C3_HOST
+void video_broadcast_host_end_field(){
+	end_field();
+}
+#endif
+
 void video_broadcast_clear_frame(){
-	bool isOddFrame = frame_number&0x01;
-	if(!isOddFrame) ets_memset( (uint8_t*)&framebuffer[0], 0, ((FBW/4)*fb_height) );
-	else ets_memset( (uint8_t*)&framebuffer[(FBW2/4) *fb_height], 0, ((FBW/4)*fb_height) );
+	ets_memset( video_broadcast_get_frame(), 0, fb_frame_bytes );
 }
 
-void video_tack_dd_pixel(uint8_t *current_frame, int x, int y, uint8_t color){
+void C3_PIXEL_ATTR video_tack_dd_pixel(uint8_t *current_frame, int x, int y, uint8_t color){
 	// Check for illegal pixels
-	if(x > FBW) return;
-	if(y > fb_height) return;
+	if(x < 0 || x >= FBW) return;
+	if(y < 0 || y >= fb_height) return;
 	if(color > C3_COL_DD_WHITE) return;
 	
 	// Put color in buffer
@@ -490,10 +1101,15 @@ void video_tack_dd_pixel(uint8_t *current_frame, int x, int y, uint8_t color){
 		*half_block &= ~( 0b10 <<((x&0b11)<<1) );
 	}
 }
-void video_tack_pixel(uint8_t *current_frame, int x, int y, uint8_t color){
+void C3_PIXEL_ATTR video_tack_pixel(uint8_t *current_frame, int x, int y, uint8_t color){
+	if(fb_mode == C3_FB_EXT64){
+		if(x < 0 || x >= FBW2 || y < 0 || y >= fb_height) return;
+		current_frame[x + y*FBW2] = color;
+		return;
+	}
+
 	// Check for illegal pixels
-	if(x > FBW) return;
-	if(y > fb_height) return;
+	if(y < 0 || y >= fb_height) return;
 	if(color > C3_COL_DD_WHITE) return;
 
 	// Call DD function if needed
@@ -501,6 +1117,7 @@ void video_tack_pixel(uint8_t *current_frame, int x, int y, uint8_t color){
 		video_tack_dd_pixel(current_frame, x, y, color);
 		return;
 	}
+	if(x < 0 || x >= FBW2) return;
 
 	// Put color in buffer
 	uint8_t *half_block = &(current_frame[(x+y*(FBW/2) )>>1]);
@@ -511,8 +1128,110 @@ void video_tack_pixel(uint8_t *current_frame, int x, int y, uint8_t color){
 	}
 }
 
-void video_broadcast_tack_pixel(int x, int y, uint8_t color){
-	bool isOddFrame = frame_number&0x01;
-	if(!isOddFrame) video_tack_pixel((uint8_t*)&framebuffer[0], x, y, color);
-	else video_tack_pixel((uint8_t*)&framebuffer[(FBW2/4) *fb_height], x, y, color);
-}
\ No newline at end of file
+void C3_PIXEL_ATTR video_tack_span(uint8_t *current_frame, int x0, int x1, int y, uint8_t color){
+	// Clip to the framebuffer
+	if(y < 0 || y >= fb_height) return;
+	if(x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+	if(fb_mode == C3_FB_EXT64){
+		if(x0 < 0) x0 = 0;
+		if(x1 >= FBW2) x1 = FBW2-1;
+		if(x0 <= x1) ets_memset(&current_frame[x0 + y*FBW2], color, x1-x0+1);
+		return;
+	}
+	if(color > C3_COL_DD_WHITE) return;
+	int width = (color >= C3_COL_DD_BLACK)?FBW:FBW2;
+	if(x0 < 0) x0 = 0;
+	if(x1 >= width) x1 = width-1;
+	if(x0 > x1) return;
+
+	uint8_t *row = &current_frame[y*(FBW/4)];
+	if(color >= C3_COL_DD_BLACK){
+		// 4 DD pixels per byte, on the odd bits
+		int b0 = x0>>2;
+		int b1 = x1>>2;
+		uint8_t mfirst = (0xAA << ((x0&3)<<1)) & 0xAA;
+		uint8_t mlast = 0xAA >> ((3-(x1&3))<<1);
+		if(b0 == b1){
+			mfirst &= mlast;
+		}
+		if(color == C3_COL_DD_WHITE){
+			row[b0] |= mfirst;
+			for(int b = b0+1; b < b1; b++) row[b] |= 0xAA;
+			if(b1 != b0) row[b1] |= mlast;
+		} else {
+			row[b0] &= ~mfirst;
+			for(int b = b0+1; b < b1; b++) row[b] &= 0x55;
+			if(b1 != b0) row[b1] &= ~mlast;
+		}
+		return;
+	}
+
+	// Odd start and even end pixels share their byte with a neighbour
+	if(x0 & 1){
+		row[x0>>1] = (row[x0>>1] & 0x0f) | color<<4;
+		x0++;
+	}
+	if(!(x1 & 1)){
+		row[x1>>1] = (row[x1>>1] & 0xf0) | color;
+		x1--;
+	}
+	if(x0 < x1) ets_memset(&row[x0>>1], color | (color<<4), (x1-x0+1)>>1);
+}
+
+/**
+ * @brief Sets or clears pixels x0..x1 of a packed 1bpp line, LSB first
+ */
+LOCAL void C3_PIXEL_ATTR video_tack_mono_span(uint8_t *row, int x0, int x1, uint8_t on){
+	if(x0 < 0) x0 = 0;
+	if(x1 >= FBW) x1 = FBW-1;
+	if(x0 > x1) return;
+	int b0 = x0>>3;
+	int b1 = x1>>3;
+	uint8_t mfirst = 0xff << (x0&7);
+	uint8_t mlast = 0xff >> (7-(x1&7));
+	if(b0 == b1) mfirst &= mlast;
+	if(on){
+		row[b0] |= mfirst;
+		if(b1 != b0){
+			if(b1 > b0+1) ets_memset(&row[b0+1], 0xff, b1-b0-1);
+			row[b1] |= mlast;
+		}
+	} else {
+		row[b0] &= ~mfirst;
+		if(b1 != b0){
+			if(b1 > b0+1) ets_memset(&row[b0+1], 0x00, b1-b0-1);
+			row[b1] &= ~mlast;
+		}
+	}
+}
+
+/**
+ * @brief Draws onto one line of a C3_FB_MIXED or C3_FB_MONO frame. On 1bpp lines the color pixels are two
+ * pixels wide, everything but black is white.
+ */
+LOCAL void C3_PIXEL_ATTR video_tack_mixed_span(int x0, int x1, int y, uint8_t color){
+	uint8_t *row = video_broadcast_get_line(y);
+	if(row == NULL || color > C3_COL_DD_WHITE) return;
+	if(x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+	if(video_broadcast_line_mode(y) == C3_LINE_COLOR){
+		video_tack_span(row, x0, x1, 0, color);
+	} else if(color >= C3_COL_DD_BLACK){
+		video_tack_mono_span(row, x0, x1, color == C3_COL_DD_WHITE);
+	} else {
+		if(x0 < 0) x0 = 0;
+		if(x1 >= FBW2) x1 = FBW2-1;
+		video_tack_mono_span(row, x0<<1, (x1<<1)+1, color != C3_COL_BLACK);
+	}
+}
+
+void C3_PIXEL_ATTR video_broadcast_tack_pixel(int x, int y, uint8_t color){
+	if(fb_mode == C3_FB_STRIP) return;
+	if(fb_mode == C3_FB_MIXED || fb_mode == C3_FB_MONO) video_tack_mixed_span(x, x, y, color);
+	else video_tack_pixel(video_broadcast_get_frame(), x, y, color);
+}
+
+void C3_PIXEL_ATTR video_broadcast_tack_span(int x0, int x1, int y, uint8_t color){
+	if(fb_mode == C3_FB_STRIP) return;
+	if(fb_mode == C3_FB_MIXED || fb_mode == C3_FB_MONO) video_tack_mixed_span(x0, x1, y, color);
+	else video_tack_span(video_broadcast_get_frame(), x0, x1, y, color);
+}
@@ -23,16 +23,136 @@
 
 #define DMABUFFERDEPTH 3
 
+#ifndef C3_STRIP_LINES
+/** @brief C3_FB_STRIP: lines in the ring, i.e. how far the renderer can get ahead of the beam */
+#define C3_STRIP_LINES 16
+#endif
+#ifndef C3_STRIP_AHEAD
+/** @brief C3_FB_STRIP: most lines rendered per interrupt, more than 1 so it can catch up after the vertical blank */
+#define C3_STRIP_AHEAD 2
+#endif
+
+/**
+ * @brief C3_FB_STRIP: fills one line (in the C3_FB_STANDARD line layout, FBW/4 bytes) right before
+ * it is sent. Runs in the video interrupt, so it has to be short.
+ * 
+ * @param y Line on screen
+ * @param line The line to fill, all of it
+ */
+typedef void (*videoLineRenderer_t)(int y, uint16_t *line);
+
+#ifndef C3_INTERLACE_SWAP_FIELDS
+/** @brief Set to 1 if C3_FB_INTERLACED looks combed, i.e. the TV shows the second field above the first */
+#define C3_INTERLACE_SWAP_FIELDS 0
+#endif
+
+/** @brief Arena bytes of the DMA line buffers */
+#define C3_ARENA_DMA_BYTES (4*160*DMABUFFERDEPTH)
+/** @brief Arena bytes of the framebuffer of C3_FB_STANDARD, C3_FB_INTERLACED and C3_FB_EXT64 (which also copies a 13 kB table) */
+#define C3_ARENA_FB_BYTES_NTSC (2*58*220)
+#define C3_ARENA_FB_BYTES_PAL (2*58*264)
+/** @brief Whole arena of C3_FB_STANDARD, video_broadcast_arena_bytes tells it for the other modes */
+#define C3_ARENA_BYTES_NTSC (C3_ARENA_FB_BYTES_NTSC + C3_ARENA_DMA_BYTES)
+#define C3_ARENA_BYTES_PAL (C3_ARENA_FB_BYTES_PAL + C3_ARENA_DMA_BYTES)
+
+#ifndef C3_STATIC_ARENA
+/**
+ * @brief Bytes of a static arena all video memory is taken from instead of malloc, e.g.
+ * -DC3_STATIC_ARENA=C3_ARENA_BYTES_NTSC. 0 for none.
+ */
+#define C3_STATIC_ARENA 0
+#endif
+
 /**
  * @brief Initialize the video broadcast. Generates video of the specified type.
  * 
  * @param videoType Type, either NTSC or PAL
+ * @return uint8_t 1 if it runs, 0 if there was not enough memory
+ */
+uint8_t ICACHE_FLASH_ATTR video_broadcast_init(channel3VideoType_t videoType);
+/**
+ * @brief Initialize the video broadcast with a framebuffer layout other than C3_FB_STANDARD.
+ * 
+ * With C3_FB_EXT64 a pixel is one byte holding a C3_EXT_RGB color, 116 pixels per line and
+ * half the lines. Only video_broadcast_tack_pixel/_tack_span draw in that mode, the 3D, text
+ * and blit functions need C3_FB_STANDARD.
+ * 
+ * C3_FB_INTERLACED has the pixels of C3_FB_STANDARD and twice the lines, the even lines are sent
+ * in the first field and the odd lines in the second. There is only one image, so drawing is
+ * visible right away unless a back buffer is set with video_broadcast_set_back_buffer.
+ * 
+ * C3_FB_MIXED takes the line modes of the last video_broadcast_set_line_modes call.
+ * C3_FB_MONO only has black and white (double density) pixels, packed 1bpp.
+ * 
+ * C3_FB_STRIP has no framebuffer, only a ring of C3_STRIP_LINES lines that the renderer set with
+ * video_broadcast_set_line_renderer fills just ahead of the beam (see display_list.h).
+ * The drawing functions do nothing in that mode.
+ * 
+ * All memory is taken before anything starts. If any of it is missing, nothing is started or kept.
+ * 
+ * @param videoType Type, either NTSC or PAL
+ * @param mode Framebuffer layout
+ * @return uint8_t 1 if it runs, 0 if there was not enough memory
  */
-void ICACHE_FLASH_ATTR video_broadcast_init(channel3VideoType_t videoType);
+uint8_t ICACHE_FLASH_ATTR video_broadcast_init_mode(channel3VideoType_t videoType, channel3FramebufferMode_t mode);
 /**
  * @brief Deinitialize the video broadcast
  */
 void video_broadcast_deinit();
+/**
+ * @brief Memory for the next init instead of malloc. Framebuffer, DMA buffers and tables are taken from
+ * it one after another, word aligned, and it has to stay valid until video_broadcast_deinit. Start-up
+ * then takes no time on the heap and uses the same memory every time.
+ * 
+ * @param arena At least video_broadcast_arena_bytes, NULL for malloc (or the C3_STATIC_ARENA)
+ * @param bytes Size of arena
+ */
+void video_broadcast_set_arena(void *arena, uint32_t bytes);
+/**
+ * @brief Size of the arena an init with these settings takes. Includes video_broadcast_reserve_standards
+ * and the line modes of C3_FB_MIXED.
+ * 
+ * @param videoType Type, either NTSC or PAL
+ * @param mode Framebuffer layout
+ * @return uint32_t Bytes
+ */
+uint32_t video_broadcast_arena_bytes(channel3VideoType_t videoType, channel3FramebufferMode_t mode);
+/**
+ * @return uint32_t Bytes of the arena the running broadcast took, 0 if it uses malloc
+ */
+uint32_t video_broadcast_arena_used();
+/**
+ * @brief Makes the next init allocate the framebuffer for the larger of NTSC and PAL, so
+ * video_broadcast_set_standard can change to either. Without it only the standard of the init and
+ * smaller ones fit. Costs the RAM of the larger standard, e.g. 5 kB more for NTSC in C3_FB_STANDARD.
+ * 
+ * @param reserve 1 to allocate for both standards
+ */
+void video_broadcast_reserve_standards(uint8_t reserve);
+/**
+ * @brief Changes the standard at the end of the current frame without stopping the DMA or allocating.
+ * The line timing, line types and framebuffer height change together, the lines already queued go out
+ * as they are. The image has the new height from the next frame drawn on, until then it may show
+ * what was drawn for the old one.
+ * 
+ * @param videoType NTSC or PAL
+ * @return uint8_t 1 if the change is pending, 0 if the framebuffer (or a back buffer of C3_FB_INTERLACED)
+ * is too small for it, see video_broadcast_reserve_standards
+ */
+uint8_t video_broadcast_set_standard(channel3VideoType_t videoType);
+/**
+ * @return uint8_t 1 while a video_broadcast_set_standard waits for the end of the frame
+ */
+uint8_t video_broadcast_standard_pending();
+/**
+ * @return channel3VideoType_t The standard being sent
+ */
+channel3VideoType_t video_broadcast_get_standard();
+/**
+ * @return uint32_t Microseconds from the last video_broadcast_set_standard until the first line of the new
+ * standard was queued, 0 while it is pending
+ */
+uint32_t video_broadcast_switch_us();
 
 /**
  * @brief Gets the current frame number
@@ -49,16 +169,115 @@ uint16_t video_broadcast_framebuffer_width();
  */
 uint16_t video_broadcast_framebuffer_height();
 
+/**
+ * @return channel3FramebufferMode_t Layout of the framebuffer
+ */
+channel3FramebufferMode_t video_broadcast_get_mode();
+/**
+ * @brief Most CPU cycles the interrupt spent on one line since the last reset
+ * 
+ * @param reset Start measuring again
+ * @return uint32_t Cycles
+ */
+uint32_t video_broadcast_line_cycles_max(uint8_t reset);
+/**
+ * @return uint32_t CPU cycles one line takes to send, the interrupt has to stay below this
+ */
+uint32_t video_broadcast_line_cycles_budget();
+
+/**
+ * @return uint32_t Size of one frame in bytes, i.e. of a back buffer
+ */
+uint32_t video_broadcast_frame_bytes();
+/**
+ * @brief Line modes for the next video_broadcast_init_mode with C3_FB_MIXED. Lines beyond count are
+ * C3_LINE_COLOR. The table is only read during init.
+ * 
+ * @param modes channel3LineMode_t per framebuffer line
+ * @param count Entries in modes
+ */
+void video_broadcast_set_line_modes(const uint8_t *modes, uint16_t count);
+/**
+ * @param y Y-Coordinate
+ * @return channel3LineMode_t Mode of that line, C3_LINE_MONO in C3_FB_MONO and C3_LINE_COLOR in the other modes but C3_FB_MIXED
+ */
+channel3LineMode_t video_broadcast_line_mode(int y);
+/**
+ * @brief C3_FB_STRIP: sets the function that renders the lines
+ * 
+ * @param renderer Renderer, NULL sends black lines
+ */
+void video_broadcast_set_line_renderer(videoLineRenderer_t renderer);
+/**
+ * @brief First byte of a line in the frame being drawn, for direct access
+ * 
+ * @param y Y-Coordinate
+ * @return uint8_t* The line, NULL if y is off screen or in C3_FB_STRIP
+ */
+uint8_t *video_broadcast_get_line(int y);
+/**
+ * @brief C3_FB_INTERLACED: draw into a second image and send it after video_broadcast_present.
+ * 
+ * @param buffer video_broadcast_frame_bytes() bytes owned by the caller, NULL to draw onto the sent image again
+ */
+void video_broadcast_set_back_buffer(uint8_t *buffer);
+/**
+ * @brief Modes with two frames: instead of alternating every frame, keep sending one frame and draw
+ * the other until video_broadcast_present. Like C3_FB_INTERLACED with a back buffer.
+ * 
+ * @param hold 1 to present manually, 0 to alternate again
+ */
+void video_broadcast_hold(uint8_t hold);
+/**
+ * @brief C3_FB_INTERLACED or held: exchange the sent image and the back buffer once the current frame
+ * (both fields) is out. Draw again after the frame number changed.
+ */
+void video_broadcast_present();
+/**
+ * @return uint8_t 1 while a video_broadcast_present waits for the end of the frame, do not draw the back buffer until then
+ */
+uint8_t video_broadcast_present_pending();
+
 /**
  * @brief Get the framebuffer
  * 
- * @return uint8_t* Pointer to the framebuffer
+ * @return uint8_t* Pointer to the framebuffer: the frame sent next in the modes with two frames, the back
+ * buffer in C3_FB_INTERLACED or when held
  */
 uint8_t *video_broadcast_get_frame();
+/**
+ * @return uint8_t* The frame being sent, the same as video_broadcast_get_frame only in C3_FB_INTERLACED without back buffer
+ */
+uint8_t *video_broadcast_get_sent_frame();
+/**
+ * @brief Makes video_broadcast_get_frame and every drawing function use frame until called with NULL, so a
+ * change of the frame number in between does not split the drawing over both frames.
+ * 
+ * @param frame A frame returned by video_broadcast_get_frame, NULL to follow the frame number again
+ */
+void video_broadcast_pin_frame(uint8_t *frame);
+#if C3_HOST
+/**
+ * @brief Host builds (tools/host) only, where the video interrupt does not run: ends a field like it does,
+ * a presented frame is swapped in and the frame number advances.
+ */
+void video_broadcast_host_end_field();
+#endif
 /**
  * @brief Clear the framebuffer
  */
 void video_broadcast_clear_frame();
+/**
+ * @brief Fills a horizontal run of pixels on a framebuffer or line buffer (y = 0), clipped to the screen.
+ * Takes the line layout of the current mode, C3_FB_STANDARD for C3_FB_STRIP and C3_FB_MIXED.
+ * 
+ * @param current_frame Frame or line
+ * @param x0 First X-Coordinate (inclusive)
+ * @param x1 Last X-Coordinate (inclusive)
+ * @param y Y-Coordinate
+ * @param color Color as specified in enum channel3ColorType_t
+ */
+void video_tack_span(uint8_t *current_frame, int x0, int x1, int y, uint8_t color);
 /**
  * @brief Puts a pixel onto the screen
  * 
@@ -67,6 +286,15 @@ void video_broadcast_clear_frame();
  * @param color Color as specified in enum channel3ColorType_t
  */
 void video_broadcast_tack_pixel(int x, int y, uint8_t color);
+/**
+ * @brief Fills a horizontal run of pixels, clipped to the screen
+ * 
+ * @param x0 First X-Coordinate (inclusive)
+ * @param x1 Last X-Coordinate (inclusive)
+ * @param y Y-Coordinate
+ * @param color Color as specified in enum channel3ColorType_t
+ */
+void video_broadcast_tack_span(int x0, int x1, int y, uint8_t color);
 
 #endif
 
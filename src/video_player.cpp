@@ -0,0 +1,249 @@
+/**
+ * @file video_player.cpp
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Plays delta compressed clips (tools/c3video.py) from LittleFS or raw flash into the framebuffer
+ * @version 0.1.0
+ * @date 2023-03-24
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+
+// --- Includes ---
+#include "video_player.h"
+#include "video_broadcast.h"
+
+// --- Defines ---
+#define OP_SKIP 0
+#define OP_COPY 1
+#define OP_FILL 2
+#define OP_UP 3
+
+// --- Private Functions ---
+LOCAL int fileRead( void *ctx, uint32_t offset, uint8_t *buf, uint16_t len ){
+	fs::File *file = (fs::File*)ctx;
+	if(!file->seek(offset)) return 0;
+	return file->read(buf, len);
+}
+
+LOCAL int flashRead( void *ctx, uint32_t offset, uint8_t *buf, uint16_t len ){
+	c3Video_t *v = (c3Video_t*)ctx;
+	if(!ESP.flashRead(v->address + offset, (uint32_t*)buf, len)) return 0;
+	return len;
+}
+
+/**
+ * @brief Makes n bytes from v->pos on available in the read buffer
+ *
+ * @return const uint8_t* The bytes or NULL if the clip ends before
+ */
+static inline const uint8_t *fetch( c3Video_t *v, uint16_t n ){
+	if(v->pos < v->bufStart || v->pos + n > v->bufStart + v->bufLen){
+		v->bufStart = v->pos & ~3;
+		int got = v->read(v->ctx, v->bufStart, (uint8_t*)v->buf, C3_VIDEO_BUF);
+		v->bufLen = (got > 0)?got:0;
+		v->bytes += v->bufLen;
+		if(v->pos + n > v->bufStart + v->bufLen) return NULL;
+	}
+	return (const uint8_t*)v->buf + (v->pos - v->bufStart);
+}
+
+/**
+ * @brief Reads the header of the frame at v->pos and remembers where it is
+ *
+ * @return int32_t Header (length and flags), -1 if the clip ends
+ */
+static int32_t frameHeader( c3Video_t *v, int32_t n ){
+	const uint8_t *p = fetch(v, 4);
+	if(p == NULL) return -1;
+	uint32_t header = p[0] | (p[1]<<8) | (p[2]<<16) | ((uint32_t)p[3]<<24);
+	v->offsetFrame[n & (C3_VIDEO_OFFSETS-1)] = n;
+	v->offset[n & (C3_VIDEO_OFFSETS-1)] = v->pos;
+	if((header >> 24) & C3V_KEYFRAME){
+		v->keyFrame = n;
+		v->keyOffset = v->pos;
+	}
+	v->pos += 4;
+	return header & 0x7fffffff;	// Flags are below 0x80, so it stays positive
+}
+
+/**
+ * @brief Moves v->pos to frame n, from the closest frame it knows the offset of
+ */
+static uint8_t seekFrame( c3Video_t *v, int32_t n ){
+	int32_t k = 0;
+	v->pos = C3V_HEADER_BYTES;
+	if(v->keyFrame >= 0 && v->keyFrame <= n){
+		k = v->keyFrame;
+		v->pos = v->keyOffset;
+	}
+	for(int32_t i = n; i > n - C3_VIDEO_OFFSETS && i > k; i--){
+		if(v->offsetFrame[i & (C3_VIDEO_OFFSETS-1)] == i){
+			k = i;
+			v->pos = v->offset[i & (C3_VIDEO_OFFSETS-1)];
+			break;
+		}
+	}
+	for(; k < n; k++){
+		int32_t header = frameHeader(v, k);
+		if(header < 0) return 0;
+		v->pos += header & 0xffffff;
+	}
+	return 1;
+}
+
+/**
+ * @brief Applies the frame at v->pos onto frame
+ */
+static uint8_t decodeFrame( c3Video_t *v, uint8_t *frame, int32_t n ){
+	int32_t header = frameHeader(v, n);
+	if(header < 0) return 0;
+	uint32_t end = v->pos + (header & 0xffffff);
+	if((header >> 24) & C3V_KEYFRAME) ets_memset(frame, 0, v->frameBytes);
+
+	uint32_t at = 0;
+	while(v->pos < end){
+		const uint8_t *p = fetch(v, 1);
+		if(p == NULL) return 0;
+		uint8_t op = *p;
+		uint32_t count = op & 0x3f;
+		v->pos++;
+		if(count == 0){
+			p = fetch(v, 2);
+			if(p == NULL) return 0;
+			count = p[0] | (p[1]<<8);
+			v->pos += 2;
+		}
+		if(at + count > v->frameBytes) return 0;
+
+		switch(op >> 6){
+			case OP_SKIP:
+				at += count;
+				break;
+			case OP_COPY:
+				// Straight out of the read buffer, refilled as often as needed
+				while(count){
+					p = fetch(v, 1);
+					if(p == NULL) return 0;
+					uint32_t avail = v->bufStart + v->bufLen - v->pos;
+					if(avail > count) avail = count;
+					memcpy(frame + at, p, avail);
+					at += avail;
+					v->pos += avail;
+					count -= avail;
+				}
+				break;
+			case OP_FILL:
+				p = fetch(v, 1);
+				if(p == NULL) return 0;
+				ets_memset(frame + at, *p, count);
+				v->pos++;
+				at += count;
+				break;
+			case OP_UP:
+				if(at < v->stride || count > v->stride) return 0;
+				memcpy(frame + at, frame + at - v->stride, count);
+				at += count;
+				break;
+		}
+	}
+	return 1;
+}
+
+// --- Public Functions ---
+uint8_t ICACHE_FLASH_ATTR c3VideoOpen( c3Video_t *v, c3VideoRead_t read, void *ctx ){
+	v->read = read;
+	v->ctx = ctx;
+	v->bufStart = 0;
+	v->bufLen = 0;
+	v->pos = 0;
+	const uint8_t *p = fetch(v, C3V_HEADER_BYTES);
+	if(p == NULL) return 0;
+	uint32_t magic = p[0] | (p[1]<<8) | (p[2]<<16) | ((uint32_t)p[3]<<24);
+	v->mode = p[4];
+	v->divisor = p[5];
+	v->frames = p[6] | (p[7]<<8);
+	v->frameBytes = p[8] | (p[9]<<8) | (p[10]<<16) | ((uint32_t)p[11]<<24);
+	v->stride = p[12] | (p[13]<<8);
+	v->lines = p[14] | (p[15]<<8);
+	if(magic != C3V_MAGIC || v->divisor == 0 || v->frames == 0) return 0;
+	if(v->mode != video_broadcast_get_mode() || v->frameBytes != video_broadcast_frame_bytes() ||
+		v->lines != video_broadcast_framebuffer_height()) return 0;
+
+	v->loop = 0;
+	v->startFrame = video_broadcast_get_frame_number();
+	for(int i = 0; i < 2; i++){
+		v->slotBuffer[i] = NULL;
+		v->slotFrame[i] = -1;
+	}
+	v->nextSlot = 0;
+	for(int i = 0; i < C3_VIDEO_OFFSETS; i++) v->offsetFrame[i] = -1;
+	v->keyFrame = -1;
+	v->cycles = 0;
+	v->cyclesMax = 0;
+	v->bytes = 0;
+	return 1;
+}
+
+uint8_t ICACHE_FLASH_ATTR c3VideoOpenFile( c3Video_t *v, fs::File *file ){
+	return c3VideoOpen(v, fileRead, file);
+}
+
+uint8_t ICACHE_FLASH_ATTR c3VideoOpenFlash( c3Video_t *v, uint32_t address ){
+	v->address = address;
+	return c3VideoOpen(v, flashRead, v);
+}
+
+void c3VideoSetLoop( c3Video_t *v, uint8_t loop ){
+	v->loop = loop;
+}
+
+uint8_t c3VideoUpdate( c3Video_t *v ){
+	int32_t n = (video_broadcast_get_frame_number() - v->startFrame) / v->divisor;
+	uint8_t ok = 1;
+	if(n >= v->frames){
+		if(v->loop){
+			n %= v->frames;
+		} else {
+			n = v->frames - 1;
+			ok = 0;
+		}
+	}
+	if(!c3VideoShow(v, n)) ok = 0;
+	if(v->mode == C3_FB_INTERLACED) video_broadcast_present();
+	return ok;
+}
+
+uint8_t c3VideoShow( c3Video_t *v, uint16_t n ){
+	uint32_t start = ESP.getCycleCount();
+	v->bytes = 0;
+	if(n >= v->frames) return 0;
+
+	// Which of the (usually two) framebuffers is it and what does it show
+	uint8_t *frame = video_broadcast_get_frame();
+	int s;
+	for(s = 0; s < 2 && v->slotBuffer[s] != frame; s++);
+	if(s == 2){
+		s = v->nextSlot;
+		v->nextSlot ^= 1;
+		v->slotBuffer[s] = frame;
+		v->slotFrame[s] = -1;
+	}
+	int32_t have = v->slotFrame[s];
+	if(have == n) return 1;
+
+	// Apply the frames it misses, or start over from the last keyframe
+	int32_t first;
+	if(have >= 0 && have < n && n - have <= C3_VIDEO_OFFSETS) first = have + 1;
+	else first = (v->keyFrame >= 0 && v->keyFrame <= n)?v->keyFrame:0;
+	v->slotFrame[s] = -1;
+	if(!seekFrame(v, first)) return 0;
+	for(int32_t k = first; k <= n; k++){
+		if(!decodeFrame(v, frame, k)) return 0;
+	}
+	v->slotFrame[s] = n;
+
+	v->cycles = ESP.getCycleCount() - start;
+	if(v->cycles > v->cyclesMax) v->cyclesMax = v->cycles;
+	return 1;
+}
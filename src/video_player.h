@@ -0,0 +1,140 @@
+/**
+ * @file video_player.h
+ * @author Paul Schlarmann (paul.schlarmann@makerspace-minden.de)
+ * @brief Plays delta compressed clips (tools/c3video.py) from LittleFS or raw flash into the framebuffer
+ * @version 0.1.0
+ * @date 2023-03-24
+ *
+ * @copyright Copyright (c) Paul Schlarmann 2023
+ *
+ */
+#ifndef ESP8266CHANNEL3VIDEOPLAYER_H
+#define ESP8266CHANNEL3VIDEOPLAYER_H
+
+// --- Includes ---
+#include <c_types.h>
+#include <FS.h>
+#include "common.h"
+
+// --- Defines ---
+#ifndef C3_VIDEO_BUF
+/** @brief Read buffer per player in bytes, multiple of 4. Bigger buffers mean fewer flash/file accesses. */
+#define C3_VIDEO_BUF 512
+#endif
+/** @brief Frame offsets the player remembers, power of two. Covers the frames the two buffers lag behind. */
+#define C3_VIDEO_OFFSETS 4
+
+/** @brief "C3V1" */
+#define C3V_MAGIC 0x31563343
+/** @brief Bytes of the file header */
+#define C3V_HEADER_BYTES 16
+/** @brief Frame header flag: the frame starts from black instead of the previous frame */
+#define C3V_KEYFRAME 0x01
+
+/*
+	File layout, all little endian:
+
+	header: uint32 magic, uint8 channel3FramebufferMode_t, uint8 video frames per clip frame,
+	        uint16 frames, uint32 bytes per frame, uint16 bytes per line, uint16 lines
+	frame:  uint32 payload length (bits 0..23) and flags (bits 24..31), payload
+
+	The payload are operations on the frame bytes, starting at the first byte. An operation
+	byte holds the operation in bits 6..7 and the count n in bits 0..5, n = 0 means the count
+	follows as uint16:
+
+	0 SKIP  n bytes stay as they are (black in keyframes)
+	1 COPY  n bytes follow
+	2 FILL  n bytes of the following byte (a run of two nibbles)
+	3 UP    n bytes as in the line above, n is at most one line
+*/
+
+// --- Typedefs ---
+/**
+ * @brief Reads from the clip
+ *
+ * @param ctx Context given to c3VideoOpen
+ * @param offset Byte offset in the clip, multiple of 4
+ * @param buf Destination, 4 byte aligned
+ * @param len Bytes to read, multiple of 4
+ * @return int Bytes read, less at the end of the clip
+ */
+typedef int (*c3VideoRead_t)(void *ctx, uint32_t offset, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief A clip being played. Quite big because of the read buffer, keep it static.
+ */
+typedef struct {
+	c3VideoRead_t read;
+	void *ctx;
+	uint32_t address;		// c3VideoOpenFlash: start of the clip in flash
+
+	// Header
+	uint8_t mode;
+	uint8_t divisor;
+	uint16_t frames;
+	uint32_t frameBytes;
+	uint16_t stride;
+	uint16_t lines;
+
+	// Playback
+	uint8_t loop;
+	int startFrame;			// video_broadcast_get_frame_number() at frame 0
+	uint8_t *slotBuffer[2];	// The framebuffers and which frame they hold, -1 unknown
+	int32_t slotFrame[2];
+	uint8_t nextSlot;
+	int32_t offsetFrame[C3_VIDEO_OFFSETS];	// Frame offsets seen last, by frame & (C3_VIDEO_OFFSETS-1)
+	uint32_t offset[C3_VIDEO_OFFSETS];
+	int32_t keyFrame;		// Last keyframe seen
+	uint32_t keyOffset;
+
+	// Read buffer
+	uint32_t buf[C3_VIDEO_BUF/4];
+	uint32_t bufStart;
+	uint16_t bufLen;
+	uint32_t pos;
+
+	// Statistics of the last c3VideoShow
+	uint32_t cycles;
+	uint32_t cyclesMax;
+	uint32_t bytes;
+} c3Video_t;
+
+// --- Public Functions ---
+/**
+ * @brief Opens a clip read through a callback. The clip has to match the running video mode.
+ *
+ * @param v Player
+ * @param read Read function
+ * @param ctx Passed to read
+ * @return uint8_t 0 if the header is broken or the clip was made for another mode or standard
+ */
+uint8_t ICACHE_FLASH_ATTR c3VideoOpen( c3Video_t *v, c3VideoRead_t read, void *ctx );
+/**
+ * @brief Opens a clip in a file, e.g. LittleFS.open("/clip.c3v", "r"). The file has to stay open.
+ */
+uint8_t ICACHE_FLASH_ATTR c3VideoOpenFile( c3Video_t *v, fs::File *file );
+/**
+ * @brief Opens a clip written to raw flash, e.g. with esptool.py write_flash
+ *
+ * @param address Flash address of the clip, multiple of 4
+ */
+uint8_t ICACHE_FLASH_ATTR c3VideoOpenFlash( c3Video_t *v, uint32_t address );
+/**
+ * @brief Start over after the last frame instead of stopping
+ */
+void c3VideoSetLoop( c3Video_t *v, uint8_t loop );
+/**
+ * @brief Call from the frame callback. Decodes the frame due now into the framebuffer being drawn.
+ * Only what changes is decoded, so anything drawn on top stays until the clip overwrites those bytes.
+ *
+ * @return uint8_t 0 after the last frame (unless looping) or if reading failed
+ */
+uint8_t c3VideoUpdate( c3Video_t *v );
+/**
+ * @brief Brings the framebuffer being drawn to clip frame n, decoding only the frames it misses
+ *
+ * @return uint8_t 0 if reading failed or the clip is broken
+ */
+uint8_t c3VideoShow( c3Video_t *v, uint16_t n );
+
+#endif /* ESP8266CHANNEL3VIDEOPLAYER_H */
@@ -0,0 +1,535 @@
+#!/usr/bin/env python3
+"""
+c3asset.py - Converts images, fonts and meshes into the packed flash formats of the library.
+
+Images are quantized to the colors premodulated_table really produces (see c3signal.py)
+through a nearest color lookup table in CIELAB, optionally dithered, and written as a
+c3Bitmap_t (src/blit.h) or as a raw framebuffer image. 4bpp rows use the framebuffer
+nibble order and "dd" images are packed as color nibbles 0/2/8/10, so both are copied
+onto the screen without any conversion.
+
+Commands:
+    image   PNG -> c3Bitmap_t or framebuffer image
+    font    BDF (or TTF with Pillow installed) -> 1bpp glyph sheet
+    mesh    OBJ -> tdMesh_t, same as obj2mesh.py
+    palette prints the derived palette, optionally as a PNG swatch
+
+Examples:
+    c3asset.py image logo.png -n logo --dither fs -o logo.h
+    c3asset.py image title.png -n title --format dd --frame -o title.h
+    c3asset.py image ship.png -n ship --format 2bpp --colors 0,7,10,14 --key 0 -o ship.h
+    c3asset.py font 6x10.bdf -n font6x10 -o font6x10.h
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import c3signal
+import obj2mesh
+
+FBW = 232		# Double density pixels per line
+FBW2 = FBW // 2	# Color pixels per line
+DD_BLACK = 0
+DD_WHITE = 10	# Both double density pixels of a color nibble lit
+
+BAYER8 = [
+	[0, 32, 8, 40, 2, 34, 10, 42],
+	[48, 16, 56, 24, 50, 18, 58, 26],
+	[12, 44, 4, 36, 14, 46, 6, 38],
+	[60, 28, 52, 20, 62, 30, 54, 22],
+	[3, 35, 11, 43, 1, 33, 9, 41],
+	[51, 19, 59, 27, 49, 17, 57, 25],
+	[15, 47, 7, 39, 13, 45, 5, 37],
+	[63, 31, 55, 23, 61, 29, 53, 21],
+]
+
+
+# --- PNG ---
+def read_png(path):
+	"""Returns (width, height, pixels) with pixels as rows of (r, g, b, a). Interlaced files are not supported."""
+	with open(path, "rb") as f:
+		data = f.read()
+	if data[:8] != b"\x89PNG\r\n\x1a\n":
+		raise ValueError("%s is not a PNG file" % path)
+	pos = 8
+	idat = b""
+	plte = []
+	trns = b""
+	while pos < len(data):
+		length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+		chunk = data[pos + 8:pos + 8 + length]
+		pos += 12 + length
+		if kind == b"IHDR":
+			width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+		elif kind == b"PLTE":
+			plte = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+		elif kind == b"tRNS":
+			trns = chunk
+		elif kind == b"IDAT":
+			idat += chunk
+		elif kind == b"IEND":
+			break
+	if interlace:
+		raise ValueError("interlaced PNGs are not supported, save %s without interlacing" % path)
+	channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+	bpp = max(1, channels * depth // 8)
+	stride = (width * channels * depth + 7) // 8
+	raw = zlib.decompress(idat)
+	rows = []
+	prev = bytearray(stride)
+	for y in range(height):
+		ftype = raw[y * (stride + 1)]
+		line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+		for i in range(stride):
+			a = line[i - bpp] if i >= bpp else 0
+			b = prev[i]
+			c = prev[i - bpp] if i >= bpp else 0
+			if ftype == 1:
+				line[i] = (line[i] + a) & 0xff
+			elif ftype == 2:
+				line[i] = (line[i] + b) & 0xff
+			elif ftype == 3:
+				line[i] = (line[i] + ((a + b) >> 1)) & 0xff
+			elif ftype == 4:
+				p = a + b - c
+				pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+				line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+		prev = line
+		rows.append(_unpack_row(line, width, ctype, depth, channels, plte, trns))
+	return width, height, rows
+
+
+def _unpack_row(line, width, ctype, depth, channels, plte, trns):
+	if depth < 8:
+		per = 8 // depth
+		vals = [(line[x // per] >> (8 - depth * (x % per + 1))) & ((1 << depth) - 1) for x in range(width)]
+	elif depth == 16:
+		vals = [line[i] for i in range(0, len(line), 2)]
+	else:
+		vals = list(line)
+	out = []
+	for x in range(width):
+		if ctype == 3:
+			i = vals[x]
+			r, g, b = plte[i]
+			out.append((r, g, b, trns[i] if i < len(trns) else 255))
+			continue
+		px = vals[x * channels:(x + 1) * channels]
+		if ctype in (0, 4):
+			v = px[0] * 255 // ((1 << depth) - 1) if depth < 8 else px[0]
+			out.append((v, v, v, px[1] if ctype == 4 else 255))
+		else:
+			out.append((px[0], px[1], px[2], px[3] if ctype == 6 else 255))
+	return out
+
+
+def write_png(path, rows):
+	"""Writes rows of (r, g, b) as an 8 bit RGB PNG."""
+	height = len(rows)
+	width = len(rows[0]) if rows else 0
+	raw = b"".join(b"\x00" + bytes(c for px in row for c in px[:3]) for row in rows)
+
+	def chunk(kind, body):
+		return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body) & 0xffffffff)
+
+	with open(path, "wb") as f:
+		f.write(b"\x89PNG\r\n\x1a\n")
+		f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+		f.write(chunk(b"IDAT", zlib.compress(raw, 9)))
+		f.write(chunk(b"IEND", b""))
+
+
+# --- Color matching ---
+def _lab(rgb):
+	def lin(c):
+		c /= 255.0
+		return c / 12.92 if c <= 0.04045 else ((c + 0.055) / 1.055) ** 2.4
+	r, g, b = (lin(c) for c in rgb)
+	x = (0.4124 * r + 0.3576 * g + 0.1805 * b) / 0.9505
+	y = 0.2126 * r + 0.7152 * g + 0.0722 * b
+	z = (0.0193 * r + 0.1192 * g + 0.9505 * b) / 1.089
+
+	def f(t):
+		return t ** (1.0 / 3) if t > 0.008856 else 7.787 * t + 16.0 / 116
+	fx, fy, fz = f(x), f(y), f(z)
+	return (116 * fy - 16, 500 * (fx - fy), 200 * (fy - fz))
+
+
+class ColorLUT:
+	"""Nearest palette color in CIELAB for every RGB555 value, built once."""
+
+	def __init__(self, palette, allowed):
+		self.palette = palette
+		self.allowed = list(allowed)
+		labs = [(i, _lab(palette[i])) for i in self.allowed]
+		self.lut = bytearray(32 * 32 * 32)
+		for r in range(32):
+			for g in range(32):
+				for b in range(32):
+					l = _lab((r * 255 // 31, g * 255 // 31, b * 255 // 31))
+					best = min(labs, key=lambda e: (e[1][0] - l[0]) ** 2 + (e[1][1] - l[1]) ** 2 + (e[1][2] - l[2]) ** 2)
+					self.lut[(r << 10) | (g << 5) | b] = best[0]
+
+	def nearest(self, r, g, b):
+		r = max(0, min(255, int(r)))
+		g = max(0, min(255, int(g)))
+		b = max(0, min(255, int(b)))
+		return self.lut[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)]
+
+
+def quantize(rows, lut, dither, strength):
+	"""Returns rows of palette indices, None for transparent pixels."""
+	height = len(rows)
+	width = len(rows[0]) if rows else 0
+	out = [[None] * width for _ in range(height)]
+	if dither == "fs":
+		err = [[[0.0, 0.0, 0.0] for _ in range(width + 2)] for _ in range(2)]
+	for y in range(height):
+		if dither == "fs":
+			err[0], err[1] = err[1], [[0.0, 0.0, 0.0] for _ in range(width + 2)]
+			# Serpentine scanning
+			xs = range(width) if y % 2 == 0 else range(width - 1, -1, -1)
+			step = 1 if y % 2 == 0 else -1
+		else:
+			xs = range(width)
+		for x in xs:
+			r, g, b, a = rows[y][x]
+			if a < 128:
+				continue
+			if dither == "ordered":
+				t = (BAYER8[y & 7][x & 7] + 0.5) / 64.0 - 0.5
+				out[y][x] = lut.nearest(r + t * strength, g + t * strength, b + t * strength)
+			elif dither == "fs":
+				e = err[0][x + 1]
+				want = (r + e[0], g + e[1], b + e[2])
+				i = lut.nearest(*want)
+				out[y][x] = i
+				got = lut.palette[i]
+				d = [(want[k] - got[k]) * strength / 255.0 for k in range(3)]
+				for dx, dy, wgt in ((step, 0, 7), (-step, 1, 3), (0, 1, 5), (step, 1, 1)):
+					tgt = err[dy][x + 1 + dx]
+					for k in range(3):
+						tgt[k] += d[k] * wgt / 16.0
+			else:
+				out[y][x] = lut.nearest(r, g, b)
+	return out
+
+
+# --- Packing ---
+def pack_rows(indices, bpp, key):
+	"""Packs rows LSB first into 32 bit words. Returns (words, stride)."""
+	width = len(indices[0])
+	ppw = 32 // bpp
+	stride = (width + ppw - 1) // ppw
+	words = []
+	for row in indices:
+		for w in range(stride):
+			v = 0
+			for k in range(ppw):
+				x = w * ppw + k
+				if x < width:
+					v |= (key if row[x] is None else row[x]) << (k * bpp)
+			words.append(v)
+	return words, stride
+
+
+def pack_rle(indices, key):
+	"""Row offset table followed by the runs, see c3Bitmap_t."""
+	offsets = []
+	body = []
+	for row in indices:
+		offsets.append(len(indices) + len(body))
+		runs = []
+		x = 0
+		while x < len(row):
+			v = key if row[x] is None else row[x]
+			n = 1
+			while x + n < len(row) and n < 16 and (key if row[x + n] is None else row[x + n]) == v:
+				n += 1
+			runs.append(((n - 1) << 4) | v)
+			x += n
+		for i in range(0, len(runs), 4):
+			body.append(sum(r << (8 * k) for k, r in enumerate(runs[i:i + 4])))
+	return offsets + body
+
+
+def pack_dd(indices):
+	"""Pairs of black/white pixels as color nibbles 0, 2, 8 or 10."""
+	out = []
+	for row in indices:
+		if len(row) & 1:
+			row = row + [0]
+		out.append([(2 if row[x] else 0) | (8 if row[x + 1] else 0) for x in range(0, len(row), 2)])
+	return out
+
+
+def c_bytes(name, data):
+	lines = ["static const uint8_t %s[] PROGMEM = {" % name]
+	for i in range(0, len(data), 16):
+		lines.append("\t" + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+	lines.append("};")
+	return "\n".join(lines)
+
+
+def bitmap_to_c(name, indices, bpp, key, rle, palette=None):
+	height = len(indices)
+	width = len(indices[0])
+	out = []
+	if rle:
+		words = pack_rle(indices, key if key is not None else 0)
+		stride = 0
+	else:
+		words, stride = pack_rows(indices, bpp, key if key is not None else 0)
+	out.append(obj2mesh.c_words(name + "_data", words))
+	if palette is not None:
+		out.append("static const uint8_t %s_palette[%d] = { %s };" % (name, len(palette), ", ".join(str(c) for c in palette)))
+	fmt = "C3_BMP_%dBPP" % bpp + (" | C3_BMP_RLE" if rle else "")
+	out.append("")
+	out.append("static const c3Bitmap_t %s = {" % name)
+	out.append("\t%s_data, %s," % (name, name + "_palette" if palette is not None else "NULL"))
+	out.append("\t%d, %d, %d, %s, %s" % (width, height, stride, fmt, "C3_BMP_NO_KEY" if key is None else key))
+	out.append("};")
+	return "\n".join(out)
+
+
+def frame_to_c(name, indices, dd):
+	"""A whole framebuffer, rows of FBW/4 bytes, for memcpy_P into video_broadcast_get_frame()."""
+	data = bytearray()
+	for row in indices:
+		line = list(row[:FBW2]) + [0] * (FBW2 - min(len(row), FBW2))
+		for x in range(0, FBW2, 2):
+			data.append((line[x] or 0) | ((line[x + 1] or 0) << 4))
+	what = "double density" if dd else "color"
+	return "// %d lines of %d byte, %s pixels\n%s" % (len(indices), FBW // 4, what, c_bytes(name, data))
+
+
+# --- Commands ---
+def parse_colors(text):
+	return [int(c, 0) for c in text.split(",")] if text else None
+
+
+def cmd_image(args, palette):
+	width, height, rows = read_png(args.input)
+	fmt = args.format
+	if fmt in ("dd", "mono"):
+		# Black and white only, judged by the real levels of the two colors
+		allowed = [c3signal.BLACK_LEVEL, c3signal.WHITE_LEVEL]
+	else:
+		allowed = parse_colors(args.colors) or list(range(16))
+	if args.key is not None and args.key in allowed and any(px[3] < 128 for row in rows for px in row):
+		allowed.remove(args.key)
+	bpp = {"4bpp": 4, "2bpp": 2, "1bpp": 1, "mono": 1, "dd": 4}[fmt]
+	if fmt in ("2bpp", "1bpp") and len(allowed) + (args.key is not None) > (1 << bpp):
+		sys.exit("%s holds %d colors, give at most that many with --colors (including --key)" % (fmt, 1 << bpp))
+
+	lut = ColorLUT(palette, allowed)
+	indices = quantize(rows, lut, args.dither, args.strength)
+	if args.preview:
+		write_png(args.preview, [[palette[i] if i is not None else (255, 0, 255) for i in row] for row in indices])
+
+	bmp_palette = None
+	key = args.key
+	if fmt in ("dd", "mono"):
+		indices = [[None if i is None else (1 if i == c3signal.WHITE_LEVEL else 0) for i in row] for row in indices]
+		if fmt == "dd":
+			if any(i is None for row in indices for i in row):
+				sys.exit("dd images can not be transparent, use --format mono")
+			indices = pack_dd(indices)
+			key = None
+		elif key is not None:
+			key = 0
+	elif fmt in ("2bpp", "1bpp"):
+		bmp_palette = sorted(set(allowed) | ({args.key} if args.key is not None else set()))
+		remap = dict((c, i) for i, c in enumerate(bmp_palette))
+		indices = [[None if i is None else remap[i] for i in row] for row in indices]
+		key = remap[args.key] if args.key is not None else None
+		bmp_palette += [0] * ((1 << bpp) - len(bmp_palette))
+
+	if args.frame:
+		if fmt not in ("4bpp", "dd"):
+			sys.exit("--frame needs --format 4bpp or dd")
+		body = frame_to_c(args.name, indices, fmt == "dd")
+		header = "#include <Arduino.h>"
+	else:
+		body = bitmap_to_c(args.name, indices, bpp, key, args.rle, bmp_palette)
+		header = "#include <blit.h>"
+	note = "// Blit in color mode, the pixels are double density pairs" if fmt == "dd" else None
+	return "\n".join(l for l in ["// Generated by tools/c3asset.py from %s, do not edit." % os.path.basename(args.input),
+		header, note, "", body] if l is not None) + "\n"
+
+
+def load_bdf(path, first, last):
+	"""Returns (cell_w, cell_h, ascent, {code: (advance, rows)}), rows as lists of 0/1 in the cell."""
+	glyphs = {}
+	with open(path, "r", errors="replace") as f:
+		lines = iter(f.read().splitlines())
+	fbx = (8, 8, 0, 0)
+	ascent = None
+	for line in lines:
+		p = line.split()
+		if not p:
+			continue
+		if p[0] == "FONTBOUNDINGBOX":
+			fbx = tuple(int(v) for v in p[1:5])
+		elif p[0] == "FONT_ASCENT":
+			ascent = int(p[1])
+		elif p[0] == "STARTCHAR":
+			code, adv, bbx, bitmap = None, fbx[0], fbx, []
+			for line in lines:
+				q = line.split()
+				if not q:
+					continue
+				if q[0] == "ENCODING":
+					code = int(q[1])
+				elif q[0] == "DWIDTH":
+					adv = int(q[1])
+				elif q[0] == "BBX":
+					bbx = tuple(int(v) for v in q[1:5])
+				elif q[0] == "BITMAP":
+					for line in lines:
+						if line.strip() == "ENDCHAR":
+							break
+						bitmap.append(int(line.strip(), 16) if line.strip() else 0)
+					break
+			if code is not None and first <= code <= last:
+				glyphs[code] = (adv, bbx, bitmap)
+	if ascent is None:
+		ascent = fbx[1] + fbx[3]
+	cell_w = max([fbx[0]] + [g[0] for g in glyphs.values()])
+	cell_h = fbx[1]
+	out = {}
+	for code, (adv, (w, h, ox, oy), bitmap) in glyphs.items():
+		rows = [[0] * cell_w for _ in range(cell_h)]
+		nbits = ((w + 7) // 8) * 8
+		top = ascent - (oy + h)
+		for r, v in enumerate(bitmap):
+			for c in range(w):
+				x, y = ox + c, top + r
+				if (v >> (nbits - 1 - c)) & 1 and 0 <= x < cell_w and 0 <= y < cell_h:
+					rows[y][x] = 1
+		out[code] = (adv, rows)
+	return cell_w, cell_h, ascent, out
+
+
+def load_ttf(path, size, first, last):
+	try:
+		from PIL import ImageFont, Image, ImageDraw
+	except ImportError:
+		sys.exit("TTF fonts need Pillow (pip install pillow), or convert the font to BDF first")
+	font = ImageFont.truetype(path, size)
+	ascent, descent = font.getmetrics()
+	cell_h = ascent + descent
+	advances = dict((c, int(round(font.getlength(chr(c))))) for c in range(first, last + 1))
+	cell_w = max(advances.values())
+	out = {}
+	for c in range(first, last + 1):
+		img = Image.new("1", (cell_w, cell_h), 0)
+		ImageDraw.Draw(img).text((0, 0), chr(c), font=font, fill=1)
+		out[c] = (advances[c], [[1 if img.getpixel((x, y)) else 0 for x in range(cell_w)] for y in range(cell_h)])
+	return cell_w, cell_h, ascent, out
+
+
+def cmd_font(args, palette):
+	if args.input.lower().endswith((".ttf", ".otf")):
+		cell_w, cell_h, ascent, glyphs = load_ttf(args.input, args.size, args.first, args.last)
+	else:
+		cell_w, cell_h, ascent, glyphs = load_bdf(args.input, args.first, args.last)
+	count = args.last - args.first + 1
+	sheet = [[0] * (cell_w * count) for _ in range(cell_h)]
+	advance = []
+	for i in range(count):
+		adv, rows = glyphs.get(args.first + i, (0, None))
+		advance.append(adv)
+		if rows is None:
+			continue
+		for y in range(cell_h):
+			for x in range(cell_w):
+				sheet[y][i * cell_w + x] = rows[y][x]
+	up = args.name.upper()
+	out = ["// Generated by tools/c3asset.py from %s, do not edit." % os.path.basename(args.input),
+		"// Draw character c with c3BlitRegion(&%s, (c - %s_FIRST) * %s_CELL_W, 0, %s_CELL_W, %s_CELL_H, x, y, C3_BLIT_DD)"
+		% (args.name, up, up, up, up),
+		"// and advance x by %s_advance[c - %s_FIRST]." % (args.name, up),
+		"#include <blit.h>", "",
+		"#define %s_FIRST %d" % (up, args.first),
+		"#define %s_LAST %d" % (up, args.last),
+		"#define %s_CELL_W %d" % (up, cell_w),
+		"#define %s_CELL_H %d" % (up, cell_h),
+		"#define %s_ASCENT %d" % (up, ascent), "",
+		"static const uint8_t %s_advance[%d] = { %s };" % (args.name, count, ", ".join(str(a) for a in advance)),
+		bitmap_to_c(args.name, sheet, 1, 0, False)]
+	return "\n".join(out) + "\n"
+
+
+def cmd_mesh(args, palette):
+	verts, faces = obj2mesh.load_obj(args.input)
+	if not verts:
+		sys.exit("no vertices in " + args.input)
+	return obj2mesh.mesh_to_c(args.name, verts, faces, args.scale, args.pos8,
+		not args.no_edges, not args.no_faces, args.keep_winding)
+
+
+def cmd_palette(args, palette):
+	if args.swatch:
+		write_png(args.swatch, [[palette[x // 16] for x in range(16 * 16)] for _ in range(16)])
+	names = ["BLACK", "DARK_GRAY", "STRIPED_GRAY_1", "GREEN_1", "TURQUOISE", "LIGHT_BLUE", "DARK_BLUE", "RED",
+		"STRIPED_GRAY_2", "GREEN_2", "WHITE", "LIGHT_YELLOW", "BABYBLUE_1", "BABYBLUE_2", "LIGHT_GRAY", "LIGHT_PINK"]
+	return "".join("%2d  #%02x%02x%02x  C3_COL_%s\n" % ((i,) + palette[i] + (names[i],)) for i in range(16))
+
+
+def main():
+	ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	ap.add_argument("--table", default=c3signal.DEFAULT_TABLE, help="broadcast_tables.cpp to derive the palette from")
+	sub = ap.add_subparsers(dest="command")
+	sub.required = True
+
+	img = sub.add_parser("image", help="PNG to bitmap")
+	img.add_argument("input")
+	img.add_argument("--format", choices=["4bpp", "2bpp", "1bpp", "dd", "mono"], default="4bpp",
+		help="4bpp/2bpp/1bpp color bitmap, dd double density packed as color nibbles, mono 1bpp for C3_BLIT_DD")
+	img.add_argument("--colors", help="comma separated color indices the image may use, default all 16")
+	img.add_argument("--key", type=int, help="transparent color index, used for pixels with alpha < 128")
+	img.add_argument("--dither", choices=["none", "ordered", "fs"], default="none", help="ordered (Bayer 8x8) or Floyd-Steinberg")
+	img.add_argument("--strength", type=float, default=None, help="dither amplitude (ordered, default 64) or error fraction (fs, default 255)")
+	img.add_argument("--rle", action="store_true", help="run length encode the rows")
+	img.add_argument("--frame", action="store_true", help="write a raw framebuffer instead of a c3Bitmap_t")
+	img.add_argument("--preview", help="write the quantized image as PNG")
+
+	fnt = sub.add_parser("font", help="BDF/TTF font to glyph sheet")
+	fnt.add_argument("input")
+	fnt.add_argument("--size", type=int, default=10, help="pixel size for TTF fonts")
+	fnt.add_argument("--first", type=int, default=32)
+	fnt.add_argument("--last", type=int, default=126)
+
+	msh = sub.add_parser("mesh", help="OBJ to tdMesh_t")
+	msh.add_argument("input")
+	msh.add_argument("--scale", type=float, default=1.0)
+	msh.add_argument("--pos8", action="store_true")
+	msh.add_argument("--no-edges", action="store_true")
+	msh.add_argument("--no-faces", action="store_true")
+	msh.add_argument("--keep-winding", action="store_true")
+
+	pal = sub.add_parser("palette", help="print the palette")
+	pal.add_argument("--swatch", help="also write it as PNG")
+
+	for p in (img, fnt, msh):
+		p.add_argument("-n", "--name", default="asset", help="C identifier")
+		p.add_argument("-o", "--output", help="output header, stdout if omitted")
+	args = ap.parse_args()
+	if getattr(args, "strength", 0) is None:
+		args.strength = 64.0 if args.dither == "ordered" else 255.0
+
+	palette = c3signal.palette(c3signal.load_table(args.table))
+	text = {"image": cmd_image, "font": cmd_font, "mesh": cmd_mesh, "palette": cmd_palette}[args.command](args, palette)
+	if getattr(args, "output", None):
+		with open(args.output, "w") as f:
+			f.write(text)
+	else:
+		sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+	main()
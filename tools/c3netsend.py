@@ -0,0 +1,556 @@
+#!/usr/bin/env python3
+"""
+c3netsend.py - Sends frames to src/net_ingest.h over UDP or TCP, and stands in for the device.
+
+Every frame is sent as the changes to the previous one, split into packets of whole
+lines. Lines that did not change are not sent at all. The device presents a frame once
+all its packets arrived and answers with a status packet; when it lost a frame it asks
+for a resync and gets a keyframe next. The protocol is described in net_ingest.h, the
+operations are the ones of c3video.py.
+
+Commands:
+    send      PNG frames (files or directories, see c3video.py) or a test pattern to a device
+    loopback  receives like the device does, to develop a server without hardware
+    selftest  runs loopback on 127.0.0.1 and sends the test pattern to it, checking every frame;
+              --device tools/host/build/c3netcheck runs src/net_ingest.cpp as the device instead,
+              --broken N breaks every Nth packet
+
+Examples:
+    c3netsend.py send 192.168.4.1 --demo --fps 60
+    c3netsend.py send 192.168.4.1 frames/ --tcp --dither ordered
+    c3netsend.py loopback --port 3333 --preview last.png
+    c3netsend.py selftest --tcp
+    c3netsend.py selftest --tcp --device tools/host/build/c3netcheck --broken 6
+"""
+import argparse
+import math
+import os
+import select
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import c3asset
+import c3signal
+import c3video
+
+MAGIC = 0x3343
+PACKET = "<HHHHBB"
+STATUS = "<HHBBHHHH"
+LAST = 0x01
+KEY = 0x02
+RESYNC = 0x01
+MAX_PACKET = 1472		# C3_NET_MAX_PACKET
+DEFAULT_PORT = 3333
+
+MODE_NAMES = {c3video.C3_FB_STANDARD: "C3_FB_STANDARD", c3video.C3_FB_EXT64: "C3_FB_EXT64",
+	c3video.C3_FB_INTERLACED: "C3_FB_INTERLACED", c3video.C3_FB_MONO: "C3_FB_MONO"}
+
+
+# --- Packets ---
+def packetize(cur, prev, stride, seq, max_packet=MAX_PACKET):
+	"""Packets turning prev (None: keyframe) into cur, lines grouped as long as they fit."""
+	lines = len(cur) // stride
+	key = prev is None
+	budget = max_packet - struct.calcsize(PACKET)
+	ranges = []
+	first = None
+	size = 0
+	for y in range(lines):
+		line = cur[y * stride:(y + 1) * stride]
+		alone = len(c3video.encode_delta(line, None if key else prev[y * stride:(y + 1) * stride], stride))
+		if first is None:
+			if alone == 0 and not key:
+				continue
+			first, size = y, 0
+		elif size + alone + 3 > budget:
+			ranges.append((first, y - first))
+			first, size = y, 0
+		size += alone + 3
+	if first is not None:
+		ranges.append((first, lines - first))
+	if not ranges:
+		# Nothing changed, the frame still has to be presented
+		ranges = [(0, 1)]
+
+	payloads = []
+	for first, count in ranges:
+		stack = [(first, count)]
+		while stack:
+			f, n = stack.pop()
+			a, b = f * stride, (f + n) * stride
+			ops = c3video.encode_delta(cur[a:b], None if key else prev[a:b], stride)
+			if len(ops) > budget and n > 1:
+				# Lines did not pack as well as alone, split
+				stack.append((f + n // 2, n - n // 2))
+				stack.append((f, n // 2))
+				continue
+			if len(ops) > budget:
+				raise ValueError("line %d does not fit into one packet" % f)
+			payloads.append((f, n, ops))
+	if len(payloads) > 256:
+		raise ValueError("frame needs more than 256 packets")
+	out = []
+	for i, (f, n, ops) in enumerate(payloads):
+		flags = (KEY if key else 0) | (LAST if i == len(payloads) - 1 else 0)
+		out.append(struct.pack(PACKET, MAGIC, seq & 0xffff, f, n, flags, i) + ops)
+	return out
+
+
+def hello():
+	return struct.pack(PACKET, MAGIC, 0, 0, 0, 0, 0)
+
+
+class Receiver:
+	"""The device side of net_ingest.cpp, applying packets to two frames."""
+
+	def __init__(self, mode, stride, lines):
+		self.mode, self.stride, self.lines = mode, stride, lines
+		self.front = bytearray(stride * lines)
+		self.back = bytearray(stride * lines)
+		self.assembling = False
+		self.seq = None
+		self.parts = set()
+		self.count = 0
+		self.key = True
+		self.need_sync = True
+		self.resync = True
+		self.presented = 0
+		self.dropped = 0
+		self.bad = 0
+		self.last_seq = 0
+		self.shown = []		# (seq, frame) of every presented frame
+
+	def status(self):
+		return struct.pack(STATUS, MAGIC, self.last_seq, RESYNC if self.resync else 0, self.mode,
+			self.stride, self.lines, self.presented & 0xffff, self.dropped & 0xffff)
+
+	def drop(self):
+		if self.assembling:
+			self.assembling = False
+			self.dropped += 1
+			self.resync = True
+			return True
+		return False
+
+	def packet(self, data):
+		"""Applies a packet, returns True if a status should be sent."""
+		if len(data) < struct.calcsize(PACKET) or len(data) > MAX_PACKET:
+			self.bad += 1
+			return False
+		magic, seq, first, count, flags, part = struct.unpack_from(PACKET, data)
+		ops = data[struct.calcsize(PACKET):]
+		if magic != MAGIC or first + count > self.lines:
+			self.bad += 1
+			return False
+		if count == 0:
+			return True
+		reply = False
+		if not self.assembling or seq != self.seq:
+			# Older frames are done with
+			if self.seq is not None and (((seq - self.seq) & 0xffff) == 0 or (seq - self.seq) & 0x8000):
+				return False
+			reply = self.drop()
+			if self.seq is not None and seq != (self.seq + 1) & 0xffff:
+				# Whole frames went missing
+				self.dropped += (seq - self.seq - 1) & 0xffff
+				self.resync = True
+			if self.need_sync:
+				self.back[:] = self.front
+			self.need_sync = False
+			self.assembling = True
+			self.seq = seq
+			self.parts = set()
+			self.count = 0
+			self.key = True
+		a, b = first * self.stride, (first + count) * self.stride
+		region = bytearray(self.back[a:b])
+		try:
+			c3video.decode_delta(ops, region, self.stride, flags & KEY)
+		except (IndexError, struct.error):
+			region = None
+		if region is None or len(region) != b - a:
+			self.bad += 1
+			return self.drop() or reply
+		self.back[a:b] = region
+		self.key = self.key and bool(flags & KEY)
+		self.parts.add(part)
+		if flags & LAST:
+			self.count = part + 1
+		if self.count == 0 or any(i not in self.parts for i in range(self.count)):
+			return reply
+		# After a loss only a keyframe shows something sensible again
+		self.assembling = False
+		if self.resync and not self.key:
+			self.dropped += 1
+			return True
+		# Present, the back buffer is brought up to date before the next frame
+		self.front, self.back = self.back, self.front
+		self.need_sync = True
+		self.resync = False
+		self.presented += 1
+		self.last_seq = seq
+		self.shown.append((seq, bytes(self.front)))
+		return True
+
+
+# --- Transport ---
+class Link:
+	"""Packets to and status from a device, over UDP or TCP with a length prefix."""
+
+	def __init__(self, host, port, tcp):
+		self.tcp = tcp
+		if tcp:
+			self.sock = socket.create_connection((host, port))
+			self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+		else:
+			self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+			self.sock.connect((host, port))
+		self.sock.settimeout(0.2)
+		self.rx = b""
+
+	def send(self, packet):
+		if self.tcp:
+			self.sock.sendall(struct.pack("<H", len(packet)) + packet)
+		else:
+			self.sock.send(packet)
+
+	def status(self, timeout=0.0):
+		"""The newest status received, None if there is none."""
+		self.sock.settimeout(timeout if timeout > 0 else 0.0001)
+		last = None
+		size = struct.calcsize(STATUS)
+		try:
+			while True:
+				if self.tcp:
+					while len(self.rx) >= size:
+						last, self.rx = struct.unpack_from(STATUS, self.rx), self.rx[size:]
+					data = self.sock.recv(4096)
+					if not data:
+						break
+					self.rx += data
+				else:
+					data = self.sock.recv(64)
+					if len(data) == size:
+						last = struct.unpack(STATUS, data)
+				self.sock.settimeout(0.0001)
+		except (socket.timeout, BlockingIOError):
+			pass
+		if self.tcp:
+			while len(self.rx) >= size:
+				last, self.rx = struct.unpack_from(STATUS, self.rx), self.rx[size:]
+		return last
+
+
+class BreakingLink(Link):
+	"""A Link that breaks every nth packet of the first frames, in turn in each of the ways in BREAKS."""
+
+	BREAKS = ["ops past the lines", "copy longer than the packet", "bad magic", "short header"]
+
+	def __init__(self, host, port, tcp, stride, every, frames):
+		Link.__init__(self, host, port, tcp)
+		self.stride = stride
+		self.every = every
+		self.frames = frames
+		self.first = None
+		self.count = 0
+		self.broken = []		# Sequence numbers of the frames a packet was broken in
+
+	def send(self, packet):
+		_, seq, first, count, flags, part = struct.unpack_from(PACKET, packet)
+		if self.first is None and count:
+			self.first = seq
+		if self.every and count and ((seq - self.first) & 0xffff) < self.frames:
+			self.count += 1
+			if self.count % self.every == 0:
+				packet = self.corrupt(packet, count, len(self.broken) % len(self.BREAKS))
+				self.broken.append(seq)
+		Link.send(self, packet)
+
+	def corrupt(self, packet, count, how):
+		header, ops = packet[:struct.calcsize(PACKET)], packet[struct.calcsize(PACKET):]
+		size = count * self.stride
+		if how == 0:
+			# FILL of one byte more than the lines hold, the real operations follow
+			return header + struct.pack("<BHB", 0x80, size + 1, 0) + ops
+		if how == 1:
+			# COPY of all the lines with at most half of the bytes in the packet
+			return header + struct.pack("<BH", 0x40, size) + bytes(min(size // 2, 1024))
+		if how == 2:
+			return struct.pack("<H", MAGIC ^ 0xffff) + packet[2:]
+		return packet[:5]
+
+
+def loopback_server(port, host="0.0.0.0", rx=None, stop=None, ready=None):
+	"""Serves rx (a Receiver) like the device until stop is set."""
+	udp = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+	udp.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+	udp.bind((host, port))
+	srv = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+	srv.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+	srv.bind((host, port))
+	srv.listen(1)
+	if ready is not None:
+		ready.set()
+	conn = None
+	buf = b""
+	try:
+		while stop is None or not stop.is_set():
+			readable, _, _ = select.select([udp, srv] + ([conn] if conn else []), [], [], 0.05)
+			if srv in readable:
+				# A new connection replaces the old one
+				if conn:
+					conn.close()
+				conn, _ = srv.accept()
+				buf = b""
+			if conn is not None and conn in readable:
+				data = conn.recv(65536)
+				if not data:
+					conn.close()
+					conn = None
+				buf += data
+				while conn is not None and len(buf) >= 2 and len(buf) >= 2 + struct.unpack_from("<H", buf)[0]:
+					n = struct.unpack_from("<H", buf)[0]
+					if rx.packet(buf[2:2 + n]):
+						conn.sendall(rx.status())
+					buf = buf[2 + n:]
+			if udp in readable:
+				data, addr = udp.recvfrom(65536)
+				if rx.packet(data):
+					udp.sendto(rx.status(), addr)
+	finally:
+		udp.close()
+		srv.close()
+		if conn:
+			conn.close()
+	return rx
+
+
+def preview(rx, fmt, path):
+	"""Writes the frame on screen as PNG, double density pixels as pairs of palette colors."""
+	palette = c3signal.palette()
+	rows = []
+	for y in range(rx.lines):
+		line = rx.front[y * rx.stride:(y + 1) * rx.stride]
+		if fmt == "mono":
+			rows.append([(255, 255, 255) if line[x >> 3] & (1 << (x & 7)) else (0, 0, 0) for x in range(len(line) * 8)])
+		elif fmt == "ext64":
+			rows.append([tuple(((b >> s) & 3) * 85 for s in (4, 2, 0)) for b in line for _ in range(2)])
+		else:
+			rows.append([palette[(b >> s) & 15] for b in line for s in (0, 4) for _ in range(2)])
+	c3asset.write_png(path, rows)
+
+
+# --- Frames ---
+def demo_frames(fmt, pal, interlaced, count):
+	"""A test pattern: color bars, a moving box and a changing counter strip."""
+	mode, width, stride, lines = c3video.layout(fmt, pal, interlaced)
+	palette = c3signal.palette()
+	lut = None
+	if fmt != "ext64":
+		allowed = list(range(16)) if fmt == "color" else [c3signal.BLACK_LEVEL, c3signal.WHITE_LEVEL]
+		lut = c3asset.ColorLUT(palette, allowed)
+	colors = [palette[i] for i in range(16)] if fmt != "mono" and fmt != "dd" else [(0, 0, 0), (255, 255, 255)]
+	frames = []
+	for n in range(count):
+		bx = int((width - 24) * (0.5 + 0.5 * math.sin(n / 15.0)))
+		by = int((lines - 24) * (0.5 + 0.5 * math.cos(n / 11.0)))
+		rows = []
+		for y in range(lines):
+			row = []
+			for x in range(width):
+				if y < lines // 8:
+					c = colors[(x * len(colors) // width)]
+				elif y > lines - 8 and x < ((n * 3) % width):
+					c = colors[-1]
+				elif bx <= x < bx + 24 and by <= y < by + 24:
+					c = colors[n % (len(colors) - 1) + 1]
+				else:
+					c = (0, 0, 0)
+				row.append(c + (255,))
+			rows.append(row)
+		frames.append(bytes(c3video.frame_bytes(rows, fmt, lut, "none", 0)))
+	return mode, stride, lines, frames
+
+
+def png_frames(args):
+	mode, width, stride, lines = c3video.layout(args.format, args.pal, args.interlaced)
+	lut = None
+	if args.format != "ext64":
+		palette = c3signal.palette()
+		allowed = list(range(16)) if args.format == "color" else [c3signal.BLACK_LEVEL, c3signal.WHITE_LEVEL]
+		lut = c3asset.ColorLUT(palette, allowed)
+	frames = []
+	for path in c3video.input_files(args.inputs):
+		_, _, rows = c3asset.read_png(path)
+		frames.append(bytes(c3video.frame_bytes(c3video.fit(rows, width, lines), args.format, lut, args.dither, args.strength)))
+	return mode, stride, lines, frames
+
+
+def stream(link, mode, stride, lines, frames, fps, loops, verbose=True):
+	"""Sends the frames at fps, keyframes whenever the device asks for them. Returns the sequence numbers used."""
+	link.send(hello())
+	st = link.status(1.0)
+	if st is None:
+		sys.exit("no answer from the device")
+	if (st[3], st[4], st[5]) != (mode, stride, lines):
+		sys.exit("the device runs %s with %d lines of %d bytes, the frames are %s with %d lines of %d bytes" %
+			(MODE_NAMES.get(st[3], st[3]), st[5], st[4], MODE_NAMES.get(mode, mode), lines, stride))
+	seq = (st[1] + 1) & 0xffff
+	prev = None
+	last_key = seq
+	sent = []
+	bytes_sent = 0
+	start = time.time()
+	for i in range(len(frames) * loops):
+		cur = frames[i % len(frames)]
+		st = link.status()
+		# Another keyframe if the device still wants one after the last one was due, or a second passed
+		if st is not None and st[2] & RESYNC and (not (st[1] - last_key) & 0x8000 or ((seq - last_key) & 0xffff) > fps):
+			prev = None
+		if prev is None:
+			last_key = seq
+		packets = packetize(cur, prev, stride, seq)
+		for p in packets:
+			link.send(p)
+			bytes_sent += len(p)
+		sent.append((seq, cur))
+		prev = cur
+		seq = (seq + 1) & 0xffff
+		delay = start + (i + 1) / float(fps) - time.time()
+		if delay > 0:
+			time.sleep(delay)
+	st = link.status(0.5)
+	if verbose:
+		took = time.time() - start
+		sys.stderr.write("%d frames in %.1f s, %d bytes per frame" % (len(sent), took, bytes_sent // max(1, len(sent))))
+		if st is not None:
+			sys.stderr.write(", device presented %d, dropped %d" % (st[6], st[7]))
+		sys.stderr.write("\n")
+	return sent
+
+
+# --- Commands ---
+def cmd_send(args):
+	if args.demo:
+		mode, stride, lines, frames = demo_frames(args.format, args.pal, args.interlaced, 120)
+	else:
+		mode, stride, lines, frames = png_frames(args)
+	if not frames:
+		sys.exit("no frames given")
+	stream(Link(args.host, args.port, args.tcp), mode, stride, lines, frames, args.fps, args.loops)
+
+
+def cmd_loopback(args):
+	mode, _, stride, lines = c3video.layout(args.format, args.pal, args.interlaced)
+	rx = Receiver(mode, stride, lines)
+	sys.stderr.write("listening on port %d (UDP and TCP) as %s, %d lines of %d bytes, ctrl-c to stop\n" %
+		(args.port, MODE_NAMES[mode], lines, stride))
+	try:
+		loopback_server(args.port, rx=rx)
+	except KeyboardInterrupt:
+		pass
+	sys.stderr.write("presented %d, dropped %d, bad %d\n" % (rx.presented, rx.dropped, rx.bad))
+	if args.preview:
+		preview(rx, args.format, args.preview)
+
+
+def run_device(args, mode, stride, lines, send):
+	"""Runs send() against args.device (tools/host/c3netcheck.cpp), returns the (seq, frame) it presented."""
+	with tempfile.NamedTemporaryFile(suffix=".frames") as out:
+		dev = subprocess.Popen([args.device, str(args.port), str(mode), "1" if args.pal else "0", out.name],
+			stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+		try:
+			if dev.stdout.readline().strip() != b"ready":
+				sys.exit("%s did not start" % args.device)
+			send()
+		finally:
+			dev.stdin.close()
+			dev.wait()
+		data = out.read()
+	size = 2 + stride * lines
+	return [(struct.unpack_from("<H", data, i)[0], data[i + 2:i + size]) for i in range(0, len(data) - size + 1, size)]
+
+
+def cmd_selftest(args):
+	mode, stride, lines, frames = demo_frames(args.format, args.pal, args.interlaced, 30)
+	link = None
+	sent = {}
+
+	def send():
+		nonlocal link
+		# The second time through the frames is not broken, the receiver has to get back in step
+		link = BreakingLink("127.0.0.1", args.port, args.tcp, stride, args.broken, len(frames))
+		try:
+			sent.update(stream(link, mode, stride, lines, frames, args.fps, 2))
+		except OSError as e:
+			# The receiver closes a TCP connection that got out of step
+			sys.exit("connection lost: %s" % e)
+
+	if args.device:
+		shown = run_device(args, mode, stride, lines, send)
+	else:
+		rx = Receiver(mode, stride, lines)
+		stop = threading.Event()
+		ready = threading.Event()
+		server = threading.Thread(target=loopback_server, args=(args.port, "127.0.0.1", rx, stop, ready))
+		server.start()
+		ready.wait()
+		try:
+			send()
+		finally:
+			stop.set()
+			server.join()
+		shown = rx.shown
+	wrong = [seq for seq, frame in shown if sent.get(seq) != frame]
+	# Frames presented after the last broken packet show the receiver is still in step
+	after = [seq for seq, _ in shown if link.broken and ((seq - link.broken[-1]) & 0xffff) < 0x8000 and seq != link.broken[-1]]
+	sys.stderr.write("%d frames presented, %d wrong, %d packets broken" % (len(shown), len(wrong), len(link.broken)))
+	if link.broken:
+		sys.stderr.write(", %d frames presented after the last one" % len(after))
+	sys.stderr.write("\n")
+	sys.exit(1 if wrong or not shown or (link.broken and not after) else 0)
+
+
+def main():
+	ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	sub = ap.add_subparsers(dest="command")
+	sub.required = True
+
+	snd = sub.add_parser("send", help="send frames to a device")
+	snd.add_argument("host")
+	snd.add_argument("inputs", nargs="*", help="PNG files or directories of them, in playing order")
+	snd.add_argument("--demo", action="store_true", help="send a test pattern instead of PNG frames")
+	snd.add_argument("--fps", type=float, default=30.0)
+	snd.add_argument("--loops", type=int, default=1, help="times to send the frames")
+	snd.add_argument("--dither", choices=["none", "ordered", "fs"], default="none")
+	snd.add_argument("--strength", type=float, default=None)
+
+	lbk = sub.add_parser("loopback", help="receive like a device")
+	lbk.add_argument("--preview", help="write the last frame as PNG when stopped")
+	tst = sub.add_parser("selftest", help="loopback and send on 127.0.0.1")
+	tst.add_argument("--fps", type=float, default=120.0)
+	tst.add_argument("--device", help="run this as the device, e.g. tools/host/build/c3netcheck")
+	tst.add_argument("--broken", type=int, default=0, metavar="N", help="break every Nth packet")
+
+	for p in (snd, lbk, tst):
+		p.add_argument("--port", type=int, default=DEFAULT_PORT)
+		p.add_argument("--format", choices=["color", "dd", "mono", "ext64"], default="color", help="see c3video.py")
+		p.add_argument("--pal", action="store_true")
+		p.add_argument("--interlaced", action="store_true")
+	for p in (snd, tst):
+		p.add_argument("--tcp", action="store_true", help="TCP instead of UDP")
+	args = ap.parse_args()
+	if getattr(args, "strength", 0) is None:
+		args.strength = 64.0 if args.dither == "ordered" else 255.0
+
+	{"send": cmd_send, "loopback": cmd_loopback, "selftest": cmd_selftest}[args.command](args)
+
+
+if __name__ == "__main__":
+	main()
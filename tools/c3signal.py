@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+c3signal.py - What the TV actually sees of premodulated_table (src/broadcast_tables.cpp).
+
+The I2S peripheral shifts every table word out MSB first at 80 MBit/s. Channel 3
+(61.25 MHz) is the image of an 18.75 MHz tone at that rate, so its spectrum is
+mirrored: the chroma of the tone's lower sideband ends up in the upper sideband of
+the TV carrier. Each table column is demodulated over one full table period
+(PREMOD_ENTRIES words) which holds a whole number of carrier and chroma cycles.
+
+Levels are scaled so that column 0 is black (Y = 0) and column 10 is white (Y = 1),
+hues are measured against the color burst column.
+
+Usage:
+    c3signal.py [src/broadcast_tables.cpp]    prints the palette
+"""
+import cmath
+import math
+import os
+import re
+import sys
+
+I2S_BIT_RATE = 80e6
+CARRIER_HZ = 61.25e6
+CHROMA_HZ = 315e6 / 88		# 3.579545 MHz
+PREMOD_ENTRIES = 44
+PREMOD_SIZE = 18
+BLACK_LEVEL = 0
+WHITE_LEVEL = 10
+COLORBURST_LEVEL = 16
+SYNC_LEVEL = 17
+
+DEFAULT_TABLE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "broadcast_tables.cpp")
+
+
+def load_table(path=DEFAULT_TABLE):
+	"""Returns the words of premodulated_table as a list of ints."""
+	with open(path, "r") as f:
+		src = f.read()
+	start = src.index("premodulated_table")
+	body = src[src.index("{", start):src.index("};", start)]
+	body = re.sub(r"//[^\n]*", "", body)
+	return [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", body)]
+
+
+def alias_frequency(rf_hz, bit_rate=I2S_BIT_RATE):
+	"""Returns (tone, mirrored): the frequency below bit_rate/2 whose image lands on rf_hz."""
+	f = math.fmod(rf_hz, bit_rate)
+	if f > bit_rate / 2:
+		return bit_rate - f, True
+	return f, False
+
+
+def column_bits(table, col, entries=PREMOD_ENTRIES, size=PREMOD_SIZE):
+	"""The bit stream of one color, as sent while a line runs through all table rows."""
+	out = []
+	for e in range(entries):
+		w = table[e * size + col]
+		out.extend((w >> b) & 1 for b in range(31, -1, -1))
+	return out
+
+
+def demodulate(bits, tone_per_bit, chroma_per_bit, mirrored=True):
+	"""
+	Returns (carrier, chroma) as complex amplitudes of the tone and of the chroma
+	subcarrier on top of it, chroma relative to the carrier phase as the TV sees it.
+	"""
+	n = len(bits)
+	w = -2j * math.pi * tone_per_bit
+	base = [(2 * b - 1) * cmath.exp(w * i) for i, b in enumerate(bits)]
+	carrier = sum(base) / n
+	# On the mirrored image the TV's upper sideband is the tone's lower sideband
+	sign = 1 if mirrored else -1
+	wc = sign * 2j * math.pi * chroma_per_bit
+	chroma = sum(x * cmath.exp(wc * i) for i, x in enumerate(base)) / n
+	if abs(carrier) > 1e-9:
+		chroma *= abs(carrier) / carrier
+	if mirrored:
+		chroma = chroma.conjugate()
+	return carrier, chroma
+
+
+def measure(table, entries=PREMOD_ENTRIES, size=PREMOD_SIZE, bit_rate=I2S_BIT_RATE, rf_hz=CARRIER_HZ, chroma_hz=CHROMA_HZ):
+	"""Returns a list of (carrier, chroma) for every column of the table."""
+	tone, mirrored = alias_frequency(rf_hz, bit_rate)
+	return [demodulate(column_bits(table, c, entries, size), tone / bit_rate, chroma_hz / bit_rate, mirrored) for c in range(size)]
+
+
+def levels_to_yuv(columns):
+	"""
+	Converts demodulated columns to (Y, U, V), Y 0..1 between black and white,
+	U and V in the same unit.
+	"""
+	black = abs(columns[BLACK_LEVEL][0])
+	white = abs(columns[WHITE_LEVEL][0])
+	scale = 1.0 / (black - white)
+	burst = columns[COLORBURST_LEVEL][1]
+	# Rotate the burst onto 180 degrees (-U). This also takes care of the negative modulation.
+	rot = -abs(burst) / burst if abs(burst) > 1e-9 else 1
+	out = []
+	for carrier, chroma in columns:
+		# Negative modulation: less carrier is brighter
+		y = (black - abs(carrier)) * scale
+		c = chroma * scale * rot
+		out.append((y, c.real, c.imag))
+	return out
+
+
+def yuv_to_rgb(y, u, v):
+	"""NTSC YUV to 8 bit sRGB-ish values (the signal is gamma encoded already)."""
+	r = y + v / 0.877
+	b = y + u / 0.492
+	g = (y - 0.299 * r - 0.114 * b) / 0.587
+	return tuple(max(0, min(255, int(round(c * 255)))) for c in (r, g, b))
+
+
+def palette(table=None, colors=16):
+	"""The RGB colors of the first colors columns of the table."""
+	if table is None:
+		table = load_table()
+	yuv = levels_to_yuv(measure(table))
+	return [yuv_to_rgb(*c) for c in yuv[:colors]]
+
+
+def main():
+	table = load_table(sys.argv[1] if len(sys.argv) > 1 else DEFAULT_TABLE)
+	columns = measure(table)
+	yuv = levels_to_yuv(columns)
+	print("col  carrier   Y      U      V     hue   rgb")
+	for c, ((carrier, chroma), (y, u, v)) in enumerate(zip(columns, yuv)):
+		hue = math.degrees(math.atan2(v, u)) % 360
+		print("%3d  %6.3f  %6.3f %6.3f %6.3f  %5.1f  #%02x%02x%02x" % ((c, abs(carrier), y, u, v, hue) + yuv_to_rgb(y, u, v)))
+
+
+if __name__ == "__main__":
+	main()
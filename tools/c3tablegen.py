@@ -0,0 +1,338 @@
+#!/usr/bin/env python3
+"""
+c3tablegen.py - Generates premodulated_table for any RF carrier, I2S clock, phase count and palette.
+
+The I2S output is a 1 bit stream. The TV carrier is the image of a tone below half the
+bit rate (see c3signal.py). One table period is PREMOD_ENTRIES words, so the tone and
+the chroma subcarrier are rounded to a whole number of cycles per period; this rounding
+is the frequency error that gets reported. Every color column is the sum of the carrier
+amplitude for its luma and a single chroma sideband, converted to bits with a band pass
+sigma-delta modulator whose noise notch sits on the tone. The result is demodulated
+again to report how close the colors came out.
+
+Columns 2 and 8 are not colors of their own, they split a word into a black and a white
+half for the double density pixels. Column 16 is the color burst, 17 the sync level.
+
+Usage:
+    c3tablegen.py --channel 4                       report only
+    c3tablegen.py --channel 4 --search 32 64        also list the best phase counts
+    c3tablegen.py --channel 4 --entries 51 -o src   write broadcast_tables.cpp/.h and broadcast_ext_table.cpp
+    c3tablegen.py --palette colors.txt -o src       16 colors as #rrggbb, one per line or comma separated
+    c3tablegen.py --channel 4 --ext                 also report the 64 color table of C3_FB_EXT64
+    c3tablegen.py --ext-only -o src                 only the 64 color table, for the stock channel 3 table
+"""
+import argparse
+import cmath
+import math
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import c3signal
+
+I2S_BASE_CLOCK = 160e6
+PREMOD_SIZE = 18
+PREMOD_SPILL = 7		# The ISR writes up to this many words past the end before it wraps
+DD_LEFT = 2				# Left double density pixel lit
+DD_RIGHT = 8			# Right double density pixel lit
+BURST_IRE = 20.0
+CHROMA_LIMIT = 0.9		# Carrier plus chroma relative to sync, above this the sigma-delta loop gets unstable
+PREMOD_EXT_SIZE = 64	# Columns of premodulated_ext_table
+
+# NTSC (M) VHF channels, visual carrier in MHz
+NTSC_CHANNELS = dict([(2, 55.25), (3, 61.25), (4, 67.25), (5, 77.25), (6, 83.25)] +
+	[(n, 175.25 + 6 * (n - 7)) for n in range(7, 14)])
+
+COLUMN_NAMES = ["Black", "Gray", "str.Gray", "", "", "", "", "", "str.Gray", "", "White", "", "", "", "", "", "C.Burst", "Sync"]
+
+
+def rgb_to_yuv(rgb):
+	r, g, b = (c / 255.0 for c in rgb)
+	y = 0.299 * r + 0.587 * g + 0.114 * b
+	return y, 0.492 * (b - y), 0.877 * (r - y)
+
+
+def load_palette(text):
+	if os.path.exists(text):
+		with open(text, "r") as f:
+			text = f.read()
+	colors = [c.strip().lstrip("#") for c in text.replace("\n", ",").split(",") if c.strip() and not c.strip().startswith("//")]
+	if len(colors) != 16:
+		sys.exit("the palette needs 16 colors, got %d" % len(colors))
+	return [tuple(int(c[i:i + 2], 16) for i in (0, 2, 4)) for c in colors]
+
+
+def plan(rf_hz, chroma_hz, bit_rate, entries):
+	"""Rounds tone and chroma to whole cycles per table period. Returns a dict with the actual frequencies."""
+	bits = entries * 32
+	tone, mirrored = c3signal.alias_frequency(rf_hz, bit_rate)
+	kt = int(round(tone / bit_rate * bits))
+	kc = int(round(chroma_hz / bit_rate * bits))
+	tone_act = kt * bit_rate / bits
+	base = rf_hz - (bit_rate - tone if mirrored else tone)
+	rf_act = base + (bit_rate - tone_act if mirrored else tone_act)
+	return {
+		"bits": bits, "kt": kt, "kc": kc, "mirrored": mirrored, "tone": tone_act,
+		"rf": rf_act, "rf_err": rf_act - rf_hz,
+		"chroma": kc * bit_rate / bits, "chroma_err": kc * bit_rate / bits - chroma_hz,
+	}
+
+
+def sigma_delta(target, wt, rng, passes=4):
+	"""1 bit band pass sigma-delta, noise transfer function 1 - 2cos(wt)z^-1 + z^-2. Returns the last pass."""
+	c = 2 * math.cos(wt)
+	e1 = rng.uniform(-0.5, 0.5)
+	e2 = rng.uniform(-0.5, 0.5)
+	for _ in range(passes):
+		out = []
+		for x in target:
+			v = x - (c * e1 - e2)
+			y = 1 if v >= 0 else -1
+			e2 = e1
+			e1 = y - v
+			out.append(1 if y > 0 else 0)
+	return out
+
+
+def synthesize(p, carrier, chroma, tries, rng):
+	"""Bits of one column with the given carrier amplitude and chroma, as c3signal.demodulate measures them."""
+	bits = p["bits"]
+	if carrier == 0 and chroma == 0:
+		return [1] * bits
+	wt = 2 * math.pi * p["kt"] / bits
+	wc = 2 * math.pi * p["kc"] / bits
+	target = []
+	for n in range(bits):
+		b = carrier + chroma * cmath.exp(1j * wc * n)
+		if p["mirrored"]:
+			b = b.conjugate()
+		target.append(2 * (b * cmath.exp(1j * wt * n)).real)
+	best = None
+	for _ in range(tries):
+		out = sigma_delta(target, wt, rng)
+		got_c, got_ch = c3signal.demodulate(out, p["kt"] / bits, p["kc"] / bits, p["mirrored"])
+		err = abs(got_c - carrier) + abs(got_ch - chroma)
+		if best is None or err < best[0]:
+			best = (err, out)
+	return best[1]
+
+
+def to_words(bits):
+	return [sum(b << (31 - k) for k, b in enumerate(bits[i:i + 32])) for i in range(0, len(bits), 32)]
+
+
+def color_target(rgb, black, white, sync):
+	"""Carrier amplitude and chroma of a color. Chroma is clipped where the carrier would go past the sync level."""
+	y, u, v = rgb_to_yuv(rgb)
+	span = black - white
+	carrier = black - y * span
+	chroma = complex(u, v) * span
+	limit = CHROMA_LIMIT * sync - carrier
+	if abs(chroma) > limit:
+		chroma *= max(0.0, limit) / abs(chroma)
+	return carrier, chroma
+
+
+def generate(p, palette, black, white, tries, seed):
+	"""Returns the table as a list of rows of PREMOD_SIZE words, plus the targets per column."""
+	rng = random.Random(seed)
+	sync = 2 / math.pi		# A hard limited carrier, the strongest the 1 bit output can do
+	black *= sync
+	white *= sync
+	span = black - white
+	targets = [color_target(rgb, black, white, sync) for rgb in palette]
+	# Burst on the black level at 180 degrees, c3signal measures hues against it
+	targets.append((black, complex(-BURST_IRE / 100.0 * span, 0)))
+	targets.append((sync, 0j))
+
+	columns = []
+	for i, (carrier, chroma) in enumerate(targets):
+		if i == len(targets) - 1:
+			wt = 2 * math.pi * p["kt"] / p["bits"]
+			bits = [1 if math.cos(wt * n) >= 0 else 0 for n in range(p["bits"])]
+		elif i in (DD_LEFT, DD_RIGHT):
+			bits = None
+		else:
+			bits = synthesize(p, carrier, chroma, tries, rng)
+		columns.append(to_words(bits) if bits else None)
+	# The double density columns are half black, half white words, the left pixel goes out first
+	for col, left, right in ((DD_LEFT, 10, 0), (DD_RIGHT, 0, 10)):
+		columns[col] = [(a & 0xffff0000) | (b & 0xffff) for a, b in zip(columns[left], columns[right])]
+	rows = [[columns[c][e] for c in range(PREMOD_SIZE)] for e in range(len(columns[0]))]
+	return rows, targets
+
+
+def ext_palette():
+	"""The 64 colors of the extended table, RGB with 2 bits each, index r<<4 | g<<2 | b."""
+	return [(85 * (i >> 4), 85 * ((i >> 2) & 3), 85 * (i & 3)) for i in range(PREMOD_EXT_SIZE)]
+
+
+def generate_ext(p, black, white, tries, seed):
+	"""Rows of PREMOD_EXT_SIZE words, on the same carrier and chroma phase as the standard table."""
+	rng = random.Random(seed)
+	sync = 2 / math.pi
+	columns = []
+	for rgb in ext_palette():
+		carrier, chroma = color_target(rgb, black * sync, white * sync, sync)
+		columns.append(to_words(synthesize(p, carrier, chroma, tries, rng)))
+	return [[columns[c][e] for c in range(PREMOD_EXT_SIZE)] for e in range(len(columns[0]))]
+
+
+def report(p, rows, targets, rf_hz, chroma_hz, bit_rate, palette):
+	table = [w for row in rows for w in row]
+	entries = len(rows)
+	print("bit rate       %.4f MBit/s, %d words (%d bits) per table period" % (bit_rate / 1e6, entries, entries * 32))
+	print("carrier        %.6f MHz wanted, %.6f MHz (%+.1f kHz, %+.0f ppm), %s image of %.6f MHz"
+		% (rf_hz / 1e6, p["rf"] / 1e6, p["rf_err"] / 1e3, p["rf_err"] / rf_hz * 1e6,
+		"mirrored" if p["mirrored"] else "direct", p["tone"] / 1e6))
+	print("chroma         %.6f MHz wanted, %.6f MHz (%+.1f Hz, %+.1f ppm)"
+		% (chroma_hz / 1e6, p["chroma"] / 1e6, p["chroma_err"], p["chroma_err"] / chroma_hz * 1e6))
+	if abs(bit_rate - 80e6) > 1:
+		print("warning        the line timing in video_broadcast.cpp counts 0.4us words, other bit rates need new intervals")
+	columns = c3signal.measure(table, entries, PREMOD_SIZE, bit_rate, p["rf"], p["chroma"])
+	yuv = c3signal.levels_to_yuv(columns)
+	print("\ncol  wanted   got      dY      hue err  sat err")
+	worst = 0
+	for i in range(16):
+		want = rgb_to_yuv(palette[i])
+		got = yuv[i]
+		cw = complex(want[1], want[2])
+		cg = complex(got[1], got[2])
+		if i in (DD_LEFT, DD_RIGHT):
+			print("%3d  double density half white word, Y %.3f" % (i, got[0]))
+			continue
+		hue = math.degrees(cmath.phase(cg / cw)) if abs(cw) > 0.02 and abs(cg) > 1e-6 else 0.0
+		worst = max(worst, abs(hue))
+		print("%3d  #%02x%02x%02x  #%02x%02x%02x  %+.3f  %+6.1f   %+.3f" % ((i,) + tuple(palette[i]) + c3signal.yuv_to_rgb(*got)
+			+ (got[0] - want[0], hue, abs(cg) - abs(cw))))
+	print("\nworst hue error %.1f degrees" % worst)
+
+
+def report_ext(p, rows, std_rows, bit_rate):
+	"""Summary of the extended table, demodulated with the burst of the standard table."""
+	entries = len(rows)
+	std = [w for row in std_rows for w in row]
+	ext = [w for row in rows for w in row]
+	burst = c3signal.measure(std, entries, PREMOD_SIZE, bit_rate, p["rf"], p["chroma"])
+	columns = c3signal.measure(ext, entries, PREMOD_EXT_SIZE, bit_rate, p["rf"], p["chroma"])
+	worst_hue = 0.0
+	worst_y = 0.0
+	for i, rgb in enumerate(ext_palette()):
+		# Scale against black, white and burst of the standard table by putting the color into a spare column
+		cols = list(burst)
+		cols[DD_LEFT] = columns[i]
+		got = c3signal.levels_to_yuv(cols)[DD_LEFT]
+		want = rgb_to_yuv(rgb)
+		worst_y = max(worst_y, abs(got[0] - want[0]))
+		cw = complex(want[1], want[2])
+		cg = complex(got[1], got[2])
+		if abs(cw) > 0.05 and abs(cg) > 1e-6:
+			worst_hue = max(worst_hue, abs(math.degrees(cmath.phase(cg / cw))))
+	print("\nextended table: %d colors, worst luma error %.3f, worst hue error %.1f degrees" % (PREMOD_EXT_SIZE, worst_y, worst_hue))
+
+
+def write_ext_table(path, rows, p, bit_rate):
+	spill = rows + rows[:PREMOD_SPILL]
+	cmd = "c3tablegen.py " + " ".join(sys.argv[1:])
+	with open(os.path.join(path, "broadcast_ext_table.cpp"), "w") as f:
+		f.write("// Generated by tools/%s, do not edit.\n" % cmd)
+		f.write("// %d colors, index r<<4 | g<<2 | b. Carrier %.4f MHz, chroma %.6f MHz, %d phases at %.1f MBit/s\n"
+			% (PREMOD_EXT_SIZE, p["rf"] / 1e6, p["chroma"] / 1e6, len(rows), bit_rate / 1e6))
+		f.write('#include <Arduino.h>\n#include "broadcast_tables.h"\n\n')
+		f.write("const uint32_t premodulated_ext_table[%d] PROGMEM = {\n" % (len(spill) * PREMOD_EXT_SIZE))
+		for row in spill:
+			for i in range(0, PREMOD_EXT_SIZE, 16):
+				f.write("\t" + "".join("0x%08x, " % w for w in row[i:i + 16]) + "\n")
+		f.write("};\n")
+
+
+def write_tables(path, rows, p, bit_rate, bck, div, args):
+	entries = len(rows)
+	spill = rows + rows[:PREMOD_SPILL]
+	cmd = "c3tablegen.py " + " ".join(sys.argv[1:])
+	with open(os.path.join(path, "broadcast_tables.cpp"), "w") as f:
+		f.write("// Generated by tools/%s, do not edit.\n" % cmd)
+		f.write("// Carrier %.4f MHz, chroma %.6f MHz, %d phases at %.1f MBit/s\n"
+			% (p["rf"] / 1e6, p["chroma"] / 1e6, entries, bit_rate / 1e6))
+		f.write('#include "broadcast_tables.h"\n\n')
+		f.write("uint32_t premodulated_table[%d] = {\n" % (len(spill) * PREMOD_SIZE))
+		f.write("//" + ", ".join(("%2d: %s" % (i, n)).ljust(9) if n else ("%2d" % i).ljust(9) for i, n in enumerate(COLUMN_NAMES)) + "\n")
+		for row in spill:
+			f.write("\t" + "".join("0x%08x, " % w for w in row) + "\n")
+		f.write("};\n")
+	with open(os.path.join(path, "broadcast_tables.h"), "w") as f:
+		f.write("// Generated by tools/%s, do not edit.\n" % cmd)
+		f.write("#include <c_types.h>\n\n")
+		f.write("#define PREMOD_ENTRIES %d\n" % entries)
+		f.write("#define PREMOD_ENTRIES_WITH_SPILL %d\n" % len(spill))
+		f.write("#define PREMOD_SIZE %d\n" % PREMOD_SIZE)
+		f.write("#define SYNC_LEVEL 17\n#define COLORBURST_LEVEL 16\n#define BLACK_LEVEL 0\n#define GRAY_LEVEL 1\n#define WHITE_LEVEL 10\n\n")
+		f.write("// I2S clock the table was generated for\n")
+		f.write("#define WS_I2S_BCK %d\n#define WS_I2S_DIV %d\n\n" % (bck, div))
+		f.write("extern uint32_t premodulated_table[%d];\n\n" % (len(spill) * PREMOD_SIZE))
+		f.write("// 64 colors for C3_FB_EXT64, same phases as premodulated_table\n")
+		f.write("#define PREMOD_EXT_SIZE %d\n" % PREMOD_EXT_SIZE)
+		f.write("extern const uint32_t premodulated_ext_table[PREMOD_ENTRIES_WITH_SPILL*PREMOD_EXT_SIZE];\n")
+
+
+def main():
+	ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	ap.add_argument("--channel", type=int, default=3, help="NTSC VHF channel (2-13)")
+	ap.add_argument("--rf", type=float, help="visual carrier in MHz, overrides --channel")
+	ap.add_argument("--chroma", type=float, default=c3signal.CHROMA_HZ / 1e6, help="chroma subcarrier in MHz")
+	ap.add_argument("--bck", type=int, default=1, help="WS_I2S_BCK")
+	ap.add_argument("--div", type=int, default=2, help="WS_I2S_DIV")
+	ap.add_argument("--entries", type=int, default=44, help="PREMOD_ENTRIES, words per table period")
+	ap.add_argument("--search", type=int, nargs=2, metavar=("MIN", "MAX"), help="list the most accurate phase counts in this range")
+	ap.add_argument("--palette", help="16 colors, default is what the current table produces")
+	ap.add_argument("--table", default=c3signal.DEFAULT_TABLE, help="table the default palette is taken from")
+	ap.add_argument("--black", type=float, default=0.74, help="carrier amplitude of black, relative to sync")
+	ap.add_argument("--white", type=float, default=0.0, help="carrier amplitude of white, relative to sync")
+	ap.add_argument("--tries", type=int, default=8, help="sigma-delta runs per color, the best one is kept")
+	ap.add_argument("--seed", type=int, default=1)
+	ap.add_argument("--ext", action="store_true", help="also report the 64 color table, it is always written along with -o")
+	ap.add_argument("--ext-only", action="store_true", help="only write the 64 color table, keep broadcast_tables.cpp/.h")
+	ap.add_argument("-o", "--output", help="directory to write broadcast_tables.cpp/.h and broadcast_ext_table.cpp to")
+	args = ap.parse_args()
+
+	if args.rf is not None:
+		rf_hz = args.rf * 1e6
+	elif args.channel in NTSC_CHANNELS:
+		rf_hz = NTSC_CHANNELS[args.channel] * 1e6
+	else:
+		sys.exit("unknown channel %d, use --rf" % args.channel)
+	chroma_hz = args.chroma * 1e6
+	bit_rate = I2S_BASE_CLOCK / (args.bck * args.div)
+
+	if args.search:
+		print("entries  carrier error   chroma error")
+		found = []
+		for n in range(args.search[0], args.search[1] + 1):
+			p = plan(rf_hz, chroma_hz, bit_rate, n)
+			found.append((abs(p["rf_err"]) / 20e3 + abs(p["chroma_err"]) / 50.0, n, p))
+		for _, n, p in sorted(found)[:10]:
+			print("%7d  %+9.1f kHz  %+9.1f Hz" % (n, p["rf_err"] / 1e3, p["chroma_err"]))
+		print("")
+
+	palette = load_palette(args.palette) if args.palette else c3signal.palette(c3signal.load_table(args.table))
+	p = plan(rf_hz, chroma_hz, bit_rate, args.entries)
+	if p["kt"] == 0 or p["tone"] >= bit_rate / 2:
+		sys.exit("the carrier falls onto a multiple of half the bit rate, pick another clock")
+	rows, targets = generate(p, palette, args.black, args.white, args.tries, args.seed)
+	report(p, rows, targets, rf_hz, chroma_hz, bit_rate, palette)
+	# The size of premodulated_ext_table follows PREMOD_ENTRIES and its phases follow the
+	# tone, so it is written every time broadcast_tables.h is or the build breaks or drifts
+	args.ext = args.ext or args.ext_only or args.output is not None
+	if args.ext:
+		ext_rows = generate_ext(p, args.black, args.white, args.tries, args.seed)
+		report_ext(p, ext_rows, rows, bit_rate)
+	if args.output:
+		if not args.ext_only:
+			write_tables(args.output, rows, p, bit_rate, args.bck, args.div, args)
+		if args.ext:
+			write_ext_table(args.output, ext_rows, p, bit_rate)
+
+
+if __name__ == "__main__":
+	main()
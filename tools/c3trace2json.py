@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+c3trace2json.py - Converts a c3TraceDump (src/trace.h) into Chrome trace JSON.
+
+Build the library and the sketch with C3_TRACE=1, start recording with
+c3TraceStart and print the ring with c3TraceDump(&Serial). Save the serial
+output, everything around the dump is ignored, and open the converted file in
+chrome://tracing or https://ui.perfetto.dev.
+
+The video interrupt, the frame timer (command ring and frame callback) and the
+sketch's own events are shown as three threads. A summary of the time spent per
+event goes to stderr.
+
+Examples:
+    c3trace2json.py serial.log -o trace.json
+    c3trace2json.py serial.log --names 0=physics,1=net -o trace.json
+    pio device monitor | tee serial.log
+"""
+import argparse
+import json
+import sys
+
+LINE_TYPES = ["FT_STA", "FT_STB", "FT_B", "FT_SRA", "FT_SRB", "FT_LIN", "FT_CLOSE_M"]
+
+# c3TraceId_t
+C3_TR_LINE = 0
+C3_TR_FIELD = 16
+C3_TR_SWAP = 17
+C3_TR_DRAIN = 18
+C3_TR_RENDER = 19
+C3_TR_USER = 32
+
+TID_ISR = 1
+TID_FRAME = 2
+TID_USER = 3
+THREADS = {TID_ISR: "video interrupt", TID_FRAME: "frame timer", TID_USER: "sketch"}
+
+
+# --- Parsing ---
+def read_dumps(lines):
+    """Returns a list of (cpu MHz, [(ccount, id, phase, arg)]) for every complete dump."""
+    dumps = []
+    events = None
+    mhz = 0
+    for line in lines:
+        words = line.strip().split()
+        if words[:2] == ["c3trace", "begin"] and len(words) >= 4:
+            mhz = int(words[2])
+            events = []
+        elif words[:2] == ["c3trace", "end"] and events is not None:
+            dumps.append((mhz, events))
+            events = None
+        elif events is not None and len(words) == 4:
+            try:
+                events.append((int(words[0], 16), int(words[1]), words[2], int(words[3])))
+            except ValueError:
+                pass  # Garbled by other output
+    return dumps
+
+
+def unwrap(events):
+    """Cycle counter to a monotonic count, it wraps every 2^32 cycles (27 s at 160 MHz)."""
+    out = []
+    base = 0
+    last = None
+    for ccount, id, phase, arg in events:
+        # Events are written in order, an interrupt span may start a little before the event ahead of it
+        if last is not None and ccount < last and last - ccount > 1 << 31:
+            base += 1 << 32
+        last = ccount
+        out.append((base + ccount, id, phase, arg))
+    return out
+
+
+# --- Conversion ---
+def name_of(id, names):
+    if id < C3_TR_FIELD:
+        return LINE_TYPES[id] if id < len(LINE_TYPES) else "line type %d" % id
+    if id >= C3_TR_USER:
+        return names.get(id - C3_TR_USER, "user %d" % (id - C3_TR_USER))
+    return {C3_TR_FIELD: "field", C3_TR_SWAP: "swap", C3_TR_DRAIN: "command ring",
+        C3_TR_RENDER: "frame callback"}.get(id, "event %d" % id)
+
+
+def thread_of(id):
+    if id < C3_TR_DRAIN:
+        return TID_ISR
+    return TID_USER if id >= C3_TR_USER else TID_FRAME
+
+
+def convert(mhz, events, names):
+    """Returns (Chrome trace events, {name: [count, total us, max us]})."""
+    if mhz <= 0:
+        sys.exit("the dump has no CPU frequency")
+    events = unwrap(events)
+    t0 = min(e[0] for e in events) if events else 0
+    trace = [{"ph": "M", "name": "thread_name", "pid": 1, "tid": tid, "args": {"name": name}}
+        for tid, name in THREADS.items()]
+    stats = {}
+    open_begin = {}
+
+    def account(name, us):
+        s = stats.setdefault(name, [0, 0.0, 0.0])
+        s[0] += 1
+        s[1] += us
+        s[2] = max(s[2], us)
+
+    for ccount, id, phase, arg in events:
+        ts = (ccount - t0) / float(mhz)
+        name = name_of(id, names)
+        tid = thread_of(id)
+        e = {"name": name, "ph": phase, "ts": ts, "pid": 1, "tid": tid, "args": {"arg": arg}}
+        if phase == "X":
+            e["dur"] = arg / float(mhz)
+            e["args"] = {"cycles": arg}
+            account(name, e["dur"])
+        elif phase == "i":
+            e["s"] = "t"
+        elif phase == "B":
+            open_begin[id] = ts
+        elif phase == "E":
+            if id not in open_begin:
+                continue  # Its begin fell out of the ring
+            account(name, ts - open_begin.pop(id))
+        trace.append(e)
+    return trace, stats
+
+
+def parse_names(text):
+    names = {}
+    for item in filter(None, (text or "").split(",")):
+        n, _, name = item.partition("=")
+        names[int(n)] = name
+    return names
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("input", nargs="?", help="serial log with a dump, stdin if not given")
+    ap.add_argument("--dump", type=int, default=-1, help="which dump of the log, 0 is the first, default the last")
+    ap.add_argument("--names", help="names of the user events, e.g. 0=physics,1=net")
+    ap.add_argument("-o", "--output", help="JSON file, stdout if not given")
+    args = ap.parse_args()
+
+    if args.input:
+        with open(args.input, errors="replace") as f:
+            dumps = read_dumps(f)
+    else:
+        dumps = read_dumps(sys.stdin)
+    if not dumps:
+        sys.exit("no complete c3trace dump found")
+    mhz, events = dumps[args.dump]
+    trace, stats = convert(mhz, events, parse_names(args.names))
+
+    doc = {"traceEvents": trace, "displayTimeUnit": "ns"}
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(doc, f)
+    else:
+        json.dump(doc, sys.stdout)
+
+    sys.stderr.write("%d events at %d MHz\n" % (len(events), mhz))
+    for name, (count, total, most) in sorted(stats.items(), key=lambda s: -s[1][1]):
+        sys.stderr.write("%-16s %7d x %9.1f us total %8.1f us avg %8.1f us max\n" % (name, count, total, total / count, most))
+
+
+if __name__ == "__main__":
+    main()
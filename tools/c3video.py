@@ -0,0 +1,286 @@
+#!/usr/bin/env python3
+"""
+c3video.py - Encodes PNG frames into a delta compressed clip for src/video_player.h.
+
+Every frame is quantized like c3asset.py does it and stored as the operations that
+turn the previous frame into it: skip unchanged bytes, copy new bytes, fill runs of
+one byte (two nibbles) and repeat the line above. Keyframes start from black, the
+first frame always is one. The layout of the clip is described in video_player.h.
+
+The frames are placed at the top left of the screen, cropped or padded with black.
+
+Commands:
+    encode  PNG frames (files or a directory) -> .c3v clip
+    info    prints the header and the frame sizes of a clip
+
+Examples:
+    c3video.py encode frames/ --dither ordered --divisor 2 -o clip.c3v
+    c3video.py encode frames/ --format mono --pal --keyint 50 -o clip.c3v
+    c3video.py info clip.c3v
+"""
+import argparse
+import glob
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import c3asset
+import c3signal
+
+MAGIC = b"C3V1"
+HEADER = "<4sBBHIHH"
+KEYFRAME = 0x01
+
+OP_SKIP = 0
+OP_COPY = 1
+OP_FILL = 2
+OP_UP = 3
+
+# channel3FramebufferMode_t
+C3_FB_STANDARD = 0
+C3_FB_EXT64 = 1
+C3_FB_INTERLACED = 2
+C3_FB_MONO = 4
+
+FBH_NTSC = 220
+FBH_PAL = 264
+
+# Operations shorter than this are cheaper as part of a COPY
+MIN_SKIP = 3
+MIN_FILL = 4
+MIN_UP = 3
+
+
+# --- Frames ---
+def layout(fmt, pal, interlaced):
+	"""Returns (mode, pixels per line, bytes per line, lines)."""
+	lines = FBH_PAL if pal else FBH_NTSC
+	if fmt == "ext64":
+		return C3_FB_EXT64, c3asset.FBW2, c3asset.FBW2, lines // 2
+	if fmt == "mono":
+		return C3_FB_MONO, c3asset.FBW, c3asset.FBW // 8, lines
+	mode = C3_FB_INTERLACED if interlaced else C3_FB_STANDARD
+	width = c3asset.FBW if fmt == "dd" else c3asset.FBW2
+	return mode, width, c3asset.FBW // 4, lines * (2 if interlaced else 1)
+
+
+def fit(rows, width, height):
+	"""Crops or pads the image to width x height, padding is opaque black."""
+	black = (0, 0, 0, 255)
+	out = []
+	for y in range(height):
+		row = list(rows[y][:width]) if y < len(rows) else []
+		out.append(row + [black] * (width - len(row)))
+	return out
+
+
+def frame_bytes(rows, fmt, lut, dither, strength):
+	"""Quantizes and packs one image into the framebuffer layout of fmt."""
+	data = bytearray()
+	if fmt == "ext64":
+		# 2 bits per channel, see C3_EXT_RGB
+		for y, row in enumerate(rows):
+			for x, (r, g, b, a) in enumerate(row):
+				t = ((c3asset.BAYER8[y & 7][x & 7] + 0.5) / 64.0 - 0.5) * 85 if dither == "ordered" else 0
+				q = [max(0, min(3, int((c + t) * 3 / 255.0 + 0.5))) for c in (r, g, b)]
+				data.append((q[0] << 4) | (q[1] << 2) | q[2])
+		return data
+
+	indices = c3asset.quantize(rows, lut, dither, strength)
+	if fmt in ("dd", "mono"):
+		indices = [[1 if i == c3signal.WHITE_LEVEL else 0 for i in row] for row in indices]
+	if fmt == "mono":
+		for row in indices:
+			for x in range(0, len(row), 8):
+				data.append(sum(row[x + k] << k for k in range(8)))
+		return data
+	if fmt == "dd":
+		indices = c3asset.pack_dd(indices)
+	for row in indices:
+		for x in range(0, len(row), 2):
+			data.append((row[x] or 0) | ((row[x + 1] or 0) << 4))
+	return data
+
+
+# --- Delta coding ---
+def op(kind, count):
+	if count < 64:
+		return bytes([(kind << 6) | count])
+	return bytes([kind << 6]) + struct.pack("<H", count)
+
+
+def run(cur, i, test, limit):
+	n = 0
+	while i + n < len(cur) and n < limit and test(i + n):
+		n += 1
+	return n
+
+
+def encode_delta(cur, prev, stride):
+	"""Operations turning prev (black if None) into cur."""
+	if prev is None:
+		prev = bytes(len(cur))
+	out = bytearray()
+	literal = bytearray()
+
+	def flush():
+		for k in range(0, len(literal), 0xffff):
+			chunk = literal[k:k + 0xffff]
+			out.extend(op(OP_COPY, len(chunk)) + chunk)
+		del literal[:]
+
+	i = 0
+	while i < len(cur):
+		skip = run(cur, i, lambda j: cur[j] == prev[j], 0xffff)
+		fill = run(cur, i, lambda j: cur[j] == cur[i], 0xffff)
+		up = run(cur, i, lambda j: j >= stride and cur[j] == cur[j - stride], stride) if i >= stride else 0
+		# The longest one wins, skipping is free for the decoder so it wins ties
+		best = max((skip, 0, OP_SKIP) if skip >= MIN_SKIP else (0, 0, OP_SKIP),
+			(up, -1, OP_UP) if up >= MIN_UP else (0, -1, OP_UP),
+			(fill, -2, OP_FILL) if fill >= MIN_FILL else (0, -2, OP_FILL))
+		n, _, kind = best
+		if n == 0:
+			literal.append(cur[i])
+			i += 1
+			continue
+		flush()
+		if kind == OP_SKIP and i + n == len(cur):
+			break
+		out.extend(op(kind, n))
+		if kind == OP_FILL:
+			out.append(cur[i])
+		i += n
+	flush()
+	return bytes(out)
+
+
+def decode_delta(payload, frame, stride, key):
+	"""Applies the operations onto frame (bytearray), the reference for video_player.cpp."""
+	if key:
+		frame[:] = bytes(len(frame))
+	pos = 0
+	at = 0
+	while pos < len(payload):
+		b = payload[pos]
+		pos += 1
+		kind, count = b >> 6, b & 0x3f
+		if count == 0:
+			count = struct.unpack_from("<H", payload, pos)[0]
+			pos += 2
+		if kind == OP_COPY:
+			frame[at:at + count] = payload[pos:pos + count]
+			pos += count
+		elif kind == OP_FILL:
+			frame[at:at + count] = bytes([payload[pos]]) * count
+			pos += 1
+		elif kind == OP_UP:
+			frame[at:at + count] = frame[at - stride:at - stride + count]
+		at += count
+	return frame
+
+
+# --- Commands ---
+def input_files(inputs):
+	files = []
+	for path in inputs:
+		if os.path.isdir(path):
+			files.extend(sorted(glob.glob(os.path.join(path, "*.png"))))
+		else:
+			files.append(path)
+	return files
+
+
+def cmd_encode(args):
+	files = input_files(args.inputs)
+	if not files:
+		sys.exit("no frames given")
+	if len(files) > 0xffff:
+		sys.exit("at most 65535 frames")
+	if args.interlaced and args.format not in ("color", "dd"):
+		sys.exit("--interlaced needs --format color or dd")
+	mode, width, stride, lines = layout(args.format, args.pal, args.interlaced)
+	size = stride * lines
+
+	lut = None
+	if args.format in ("color", "dd", "mono"):
+		palette = c3signal.palette(c3signal.load_table(args.table))
+		allowed = list(range(16)) if args.format == "color" else [c3signal.BLACK_LEVEL, c3signal.WHITE_LEVEL]
+		lut = c3asset.ColorLUT(palette, allowed)
+
+	body = bytearray()
+	prev = None
+	shown = bytearray(size)
+	sizes = []
+	for n, path in enumerate(files):
+		_, _, rows = c3asset.read_png(path)
+		cur = frame_bytes(fit(rows, width, lines), args.format, lut, args.dither, args.strength)
+		key = n == 0 or (args.keyint > 0 and n % args.keyint == 0)
+		payload = encode_delta(cur, None if key else prev, stride)
+		# Decode it again, the clip has to reproduce every frame exactly
+		decode_delta(payload, shown, stride, key)
+		if shown != cur:
+			sys.exit("internal error: frame %d does not decode to itself" % n)
+		body += struct.pack("<I", len(payload) | ((KEYFRAME if key else 0) << 24)) + payload
+		sizes.append(len(payload))
+		prev = cur
+
+	with open(args.output, "wb") as f:
+		f.write(struct.pack(HEADER, MAGIC, mode, args.divisor, len(files), size, stride, lines))
+		f.write(body)
+	sys.stderr.write("%d frames of %d bytes, %d bytes per frame on average, at most %d, %d bytes total\n" %
+		(len(files), size, sum(sizes) // len(sizes), max(sizes), 16 + len(body)))
+
+
+def cmd_info(args):
+	with open(args.input, "rb") as f:
+		data = f.read()
+	magic, mode, divisor, frames, size, stride, lines = struct.unpack_from(HEADER, data)
+	if magic != MAGIC:
+		sys.exit("%s is not a clip" % args.input)
+	names = {C3_FB_STANDARD: "C3_FB_STANDARD", C3_FB_EXT64: "C3_FB_EXT64", C3_FB_INTERLACED: "C3_FB_INTERLACED", C3_FB_MONO: "C3_FB_MONO"}
+	print("%s, %d lines of %d bytes, %d frames, every frame shown %d times" % (names.get(mode, mode), lines, stride, frames, divisor))
+	pos = struct.calcsize(HEADER)
+	frame = bytearray(size)
+	for n in range(frames):
+		header = struct.unpack_from("<I", data, pos)[0]
+		length, key = header & 0xffffff, (header >> 24) & KEYFRAME
+		decode_delta(data[pos + 4:pos + 4 + length], frame, stride, key)
+		if args.frames:
+			print("%5d %s %6d bytes" % (n, "key" if key else "   ", length))
+		pos += 4 + length
+	print("%d bytes" % len(data))
+
+
+def main():
+	ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	ap.add_argument("--table", default=c3signal.DEFAULT_TABLE, help="broadcast_tables.cpp to derive the palette from")
+	sub = ap.add_subparsers(dest="command")
+	sub.required = True
+
+	enc = sub.add_parser("encode", help="PNG frames to clip")
+	enc.add_argument("inputs", nargs="+", help="PNG files or directories of them, in playing order")
+	enc.add_argument("--format", choices=["color", "dd", "mono", "ext64"], default="color",
+		help="color 116 pixel 4bpp, dd 232 pixel black and white, both C3_FB_STANDARD; mono for C3_FB_MONO; ext64 for C3_FB_EXT64")
+	enc.add_argument("--pal", action="store_true", help="PAL line count instead of NTSC")
+	enc.add_argument("--interlaced", action="store_true", help="twice the lines for C3_FB_INTERLACED")
+	enc.add_argument("--divisor", type=int, default=1, help="video frames every clip frame is shown, 2 halves the frame rate")
+	enc.add_argument("--keyint", type=int, default=0, help="keyframe every that many frames, 0 only the first")
+	enc.add_argument("--dither", choices=["none", "ordered", "fs"], default="none", help="ordered (Bayer 8x8) or Floyd-Steinberg")
+	enc.add_argument("--strength", type=float, default=None, help="dither amplitude (ordered, default 64) or error fraction (fs, default 255)")
+	enc.add_argument("-o", "--output", required=True)
+
+	inf = sub.add_parser("info", help="print a clip's header")
+	inf.add_argument("input")
+	inf.add_argument("--frames", action="store_true", help="list every frame")
+	args = ap.parse_args()
+	if getattr(args, "strength", 0) is None:
+		args.strength = 64.0 if args.dither == "ordered" else 255.0
+	if getattr(args, "divisor", 1) < 1 or getattr(args, "divisor", 1) > 255:
+		sys.exit("--divisor has to be 1..255")
+
+	{"encode": cmd_encode, "info": cmd_info}[args.command](args)
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,9 @@
+/*
+	examples/11_Benchmark built for the PC, prints the same CSV lines
+*/
+#include "../../examples/11_Benchmark/11_Benchmark.ino"
+
+int main(){
+	setup();
+	return 0;
+}
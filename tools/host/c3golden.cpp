@@ -0,0 +1,273 @@
+/*
+	c3golden - golden image checks for the renderer on the PC
+
+	Runs fixed drawing workloads into the C3_FB_STANDARD framebuffer, decodes
+	it into a 232 pixel wide image (a color pixel is two pixels, double density
+	pixels one) and writes it as PPM or compares it with a PPM written before.
+
+	The images of the current revision are checked in under golden/, make check
+	compares against them. Record them again when a change to the drawing code
+	changes the output on purpose:
+
+		./build/c3golden record golden/
+		./build/c3golden check golden/
+
+	check writes <name>.actual.ppm and <name>.diff.ppm (differing pixels red)
+	next to every image that does not match and exits with 1.
+*/
+#include <esp8266channel3lib.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <string>
+#include <vector>
+
+#define WIDTH 232
+
+typedef std::vector<uint8_t> image_t;
+
+/** @brief RGB of the 16 colors, as tools/c3signal.py demodulates them */
+static const uint32_t palette[16] = {
+	0x000000, 0x4e4e4e, 0x777777, 0x7ab700, 0x00e112, 0x1786ff, 0xdc16ff, 0xff3a24,
+	0x888888, 0xadca00, 0xffffff, 0xc0d73a, 0x7aec91, 0x8dbeff, 0xe995ff, 0xff9e92,
+};
+
+// --- Workloads ---
+static const char page[] =
+	"ESP8266 Channel 3 golden image\n"
+	"The quick brown fox jumps over\n"
+	"the lazy dog. 0123456789 !?#%&\n"
+	"THE QUICK BROWN FOX JUMPS OVER\n"
+	"THE LAZY DOG. ()[]{}<>+-*/=:;,.\n"
+	"abcdefghijklmnopqrstuvwxyz\n"
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZ\n";
+
+static void sphere( int angle ){
+	tdIdentity(ProjectionMatrix);
+	Perspective(600, 250, 50, 8192, ProjectionMatrix);
+	tdIdentity(ModelviewMatrix);
+	tdTranslate(ModelviewMatrix, 0, 0, 700);
+	tdRotateEA(ModelviewMatrix, angle, angle*2, 0);
+	CNFGColor(C3_COL_WHITE);
+	DrawGeoSphere();
+}
+
+static void sphere0(){ sphere(0); }
+static void sphere45(){ sphere(45); }
+static void sphere100(){ sphere(100); }
+
+static void textPage( uint8_t color, int scale, uint8_t cached ){
+	CNFGGlyphCacheEnable(cached);
+	CNFGGlyphCacheFlush();
+	CNFGColor(color);
+	CNFGPenX = 2;
+	CNFGPenY = 2;
+	CNFGDrawText(page, scale);
+	CNFGGlyphCacheEnable(0);
+}
+
+static void textDD(){ textPage(C3_COL_DD_WHITE, 2, 0); }
+static void textDDCached(){ textPage(C3_COL_DD_WHITE, 2, 1); }
+static void textColor(){ textPage(C3_COL_LIGHT_YELLOW, 3, 0); }
+static void textColorCached(){ textPage(C3_COL_LIGHT_YELLOW, 3, 1); }
+
+static void rectEdges(){
+	int w = WIDTH/2;
+	int h = video_broadcast_framebuffer_height();
+	// On the edges, over them and across the whole screen
+	CNFGColor(C3_COL_RED);
+	CNFGTackRectangle(0, 0, 9, 9);
+	CNFGColor(C3_COL_GREEN_2);
+	CNFGTackRectangle(w - 10, h - 10, w - 1, h - 1);
+	CNFGColor(C3_COL_LIGHT_BLUE);
+	CNFGTackRectangle(-5, h/2, 5, h/2 + 10);
+	CNFGColor(C3_COL_LIGHT_PINK);
+	CNFGTackRectangle(w - 5, 20, w + 5, 30);
+	CNFGColor(C3_COL_DARK_BLUE);
+	CNFGTackRectangle(30, -8, 40, 3);
+	CNFGColor(C3_COL_TURQUOISE);
+	CNFGTackRectangle(50, h - 3, 60, h + 8);
+	CNFGColor(C3_COL_DARK_GRAY);
+	CNFGTackRectangle(0, 100, w - 1, 100);
+	CNFGColor(C3_COL_WHITE);
+	CNFGDrawBox(20, 40, 90, 80);
+}
+
+static void lineEdges(){
+	int w = WIDTH/2;
+	int h = video_broadcast_framebuffer_height();
+	CNFGColor(C3_COL_WHITE);
+	CNFGTackSegment(0, 0, w - 1, 0);
+	CNFGTackSegment(0, h - 1, w - 1, h - 1);
+	CNFGTackSegment(0, 0, 0, h - 1);
+	CNFGTackSegment(w - 1, 0, w - 1, h - 1);
+	CNFGColor(C3_COL_GREEN_1);
+	CNFGTackSegment(-20, -20, w + 20, h + 20);
+	CNFGTackSegment(w + 20, -20, -20, h + 20);
+	CNFGColor(C3_COL_RED);
+	for(int i = 0; i < 16; i++) CNFGTackSegment(w/2, h/2, -30 + i*12, -10);
+	CNFGColor(C3_COL_DD_WHITE);
+	for(int i = 0; i < 16; i++) CNFGTackSegment(w/2, h/2, -30 + i*12, h + 10);
+}
+
+static void pixelEdges(){
+	int w = WIDTH/2;
+	int h = video_broadcast_framebuffer_height();
+	for(int i = -1; i <= 1; i++){
+		video_broadcast_tack_pixel(i, 5, C3_COL_WHITE);
+		video_broadcast_tack_pixel(w - 1 + i, 5, C3_COL_WHITE);
+		video_broadcast_tack_pixel(5, i, C3_COL_RED);
+		video_broadcast_tack_pixel(5, h - 1 + i, C3_COL_RED);
+		video_broadcast_tack_pixel(WIDTH - 1 + i, 9, C3_COL_DD_WHITE);
+		video_broadcast_tack_pixel(2*i + 20, 9, C3_COL_DD_WHITE);
+	}
+	video_broadcast_tack_span(-10, w + 10, 20, C3_COL_LIGHT_BLUE);
+	video_broadcast_tack_span(-10, WIDTH + 10, 22, C3_COL_DD_WHITE);
+	video_broadcast_tack_span(3, 8, 24, C3_COL_DD_WHITE);
+	video_broadcast_tack_span(3, 8, 26, C3_COL_WHITE);
+}
+
+static void triangles(){
+	int w = WIDTH/2;
+	int h = video_broadcast_framebuffer_height();
+	CNFGColor(C3_COL_TURQUOISE);
+	CNFGTackTriangle(10, 10, 100, 30, 40, 120);
+	CNFGColor(C3_COL_LIGHT_PINK);
+	CNFGTackTriangle(-20, h - 40, 60, h + 20, w + 10, h - 10);
+}
+
+static const struct {
+	const char *name;
+	void (*draw)();
+} workloads[] = {
+	{ "geosphere_0", sphere0 },
+	{ "geosphere_45", sphere45 },
+	{ "geosphere_100", sphere100 },
+	{ "text_dd", textDD },
+	{ "text_dd_cached", textDDCached },
+	{ "text_color", textColor },
+	{ "text_color_cached", textColorCached },
+	{ "rect_edges", rectEdges },
+	{ "line_edges", lineEdges },
+	{ "pixel_edges", pixelEdges },
+	{ "triangles", triangles },
+};
+
+// --- Images ---
+/**
+ * @brief Decodes the frame being drawn. The nibbles 0, 2, 8 and 10 are double density pixels
+ * (bit 1 the left one, bit 3 the right one), the others color pixels.
+ */
+static image_t decode(){
+	int h = video_broadcast_framebuffer_height();
+	const uint8_t *frame = video_broadcast_get_frame();
+	image_t img(WIDTH*h*3);
+	for(int y = 0; y < h; y++){
+		for(int x = 0; x < WIDTH/2; x++){
+			uint8_t b = frame[y*(WIDTH/4) + x/2];
+			uint8_t n = (x & 1)?(b >> 4):(b & 0x0f);
+			uint32_t left = palette[n];
+			uint32_t right = palette[n];
+			if((n & 0x05) == 0){
+				left = (n & 0x02)?0xffffff:0;
+				right = (n & 0x08)?0xffffff:0;
+			}
+			uint8_t *p = &img[(y*WIDTH + 2*x)*3];
+			p[0] = left >> 16; p[1] = left >> 8; p[2] = left;
+			p[3] = right >> 16; p[4] = right >> 8; p[5] = right;
+		}
+	}
+	return img;
+}
+
+static bool writePPM( const std::string &path, const image_t &img ){
+	FILE *f = fopen(path.c_str(), "wb");
+	if(f == NULL) return false;
+	fprintf(f, "P6\n%d %d\n255\n", WIDTH, (int)(img.size()/3/WIDTH));
+	bool ok = fwrite(img.data(), 1, img.size(), f) == img.size();
+	return fclose(f) == 0 && ok;
+}
+
+static bool readPPM( const std::string &path, image_t &img ){
+	FILE *f = fopen(path.c_str(), "rb");
+	if(f == NULL) return false;
+	int w, h, max;
+	bool ok = fscanf(f, "P6 %d %d %d", &w, &h, &max) == 3 && fgetc(f) != EOF && w == WIDTH && max == 255;
+	if(ok){
+		img.resize(w*h*3);
+		ok = fread(img.data(), 1, img.size(), f) == img.size();
+	}
+	fclose(f);
+	return ok;
+}
+
+static int usage(){
+	fprintf(stderr, "usage: c3golden record|check <directory> [name...]\n       c3golden list\n");
+	return 2;
+}
+
+int main( int argc, char **argv ){
+	if(argc >= 2 && std::string(argv[1]) == "list"){
+		for(const auto &w : workloads) printf("%s\n", w.name);
+		return 0;
+	}
+	if(argc < 3) return usage();
+	std::string cmd = argv[1];
+	std::string dir = std::string(argv[2]) + "/";
+	if(cmd != "record" && cmd != "check") return usage();
+	if(cmd == "record" && mkdir(argv[2], 0777) != 0 && errno != EEXIST){
+		fprintf(stderr, "can not create %s\n", argv[2]);
+		return 1;
+	}
+
+	video_broadcast_init_mode(NTSC, C3_FB_STANDARD);
+	int failed = 0;
+	int run = 0;
+	for(const auto &w : workloads){
+		bool wanted = argc == 3;
+		for(int i = 3; i < argc; i++) wanted |= std::string(argv[i]) == w.name;
+		if(!wanted) continue;
+		run++;
+
+		video_broadcast_clear_frame();
+		w.draw();
+		image_t img = decode();
+		std::string path = dir + w.name + ".ppm";
+		if(cmd == "record"){
+			if(!writePPM(path, img)){
+				fprintf(stderr, "can not write %s\n", path.c_str());
+				return 1;
+			}
+			printf("%-20s recorded\n", w.name);
+			continue;
+		}
+
+		image_t golden;
+		if(!readPPM(path, golden) || golden.size() != img.size()){
+			printf("%-20s FAIL, no golden image %s\n", w.name, path.c_str());
+			failed++;
+			continue;
+		}
+		image_t diff(img.size());
+		int pixels = 0;
+		for(size_t i = 0; i < img.size(); i += 3){
+			bool same = memcmp(&img[i], &golden[i], 3) == 0;
+			if(!same) pixels++;
+			// Differences red over a dimmed image
+			diff[i] = same?img[i]/4:255;
+			diff[i+1] = same?img[i+1]/4:0;
+			diff[i+2] = same?img[i+2]/4:0;
+		}
+		if(pixels == 0){
+			printf("%-20s ok\n", w.name);
+			continue;
+		}
+		printf("%-20s FAIL, %d pixels differ\n", w.name, pixels);
+		writePPM(dir + w.name + ".actual.ppm", img);
+		writePPM(dir + w.name + ".diff.ppm", diff);
+		failed++;
+	}
+	video_broadcast_deinit();
+	if(run == 0) return usage();
+	if(cmd == "check") printf("%d of %d images differ\n", failed, run);
+	return failed?1:0;
+}
@@ -0,0 +1,70 @@
+/*
+	c3netcheck - src/net_ingest.cpp as the device, on 127.0.0.1
+
+	Listens like a sketch calling c3NetPoll() from loop(), with the sockets of the PC
+	behind the WiFiUDP/WiFiServer stand-ins. A presented frame is swapped in right away
+	and appended to <frames> as uint16 sequence number and the frame bytes. Runs until
+	stdin is closed, prints "ready" once listening.
+
+		./build/c3netcheck <port> <channel3FramebufferMode_t> <0 NTSC, 1 PAL> <frames>
+
+	tools/c3netsend.py selftest --device build/c3netcheck runs it and checks the frames,
+	make check does that over UDP and TCP with broken packets in between.
+*/
+#include <esp8266channel3lib.h>
+#include <poll.h>
+#include <unistd.h>
+
+int main( int argc, char **argv ){
+	if(argc != 5){
+		fprintf(stderr, "usage: c3netcheck <port> <mode> <0 NTSC, 1 PAL> <frames>\n");
+		return 2;
+	}
+	channel3FramebufferMode_t mode = (channel3FramebufferMode_t)atoi(argv[2]);
+	if(!video_broadcast_init_mode(atoi(argv[3])?PAL:NTSC, mode)){
+		fprintf(stderr, "can not init mode %d\n", mode);
+		return 1;
+	}
+	uint8_t *back = NULL;
+	if(mode == C3_FB_INTERLACED){
+		back = (uint8_t*)calloc(1, video_broadcast_frame_bytes());
+		video_broadcast_set_back_buffer(back);
+	}
+	if(!c3NetBegin(atoi(argv[1]))){
+		fprintf(stderr, "mode %d is not supported\n", mode);
+		return 1;
+	}
+	FILE *out = fopen(argv[4], "wb");
+	if(out == NULL){
+		fprintf(stderr, "can not write %s\n", argv[4]);
+		return 1;
+	}
+	printf("ready\n");
+	fflush(stdout);
+
+	uint16_t presented = 0;
+	for(;;){
+		c3NetPoll();
+		if(video_broadcast_present_pending()) video_broadcast_host_end_field();
+		const c3NetStats_t *st = c3NetGetStats();
+		if(st->presented != presented){
+			presented = st->presented;
+			uint8_t seq[2] = { (uint8_t)(st->lastSeq & 0xff), (uint8_t)(st->lastSeq >> 8) };
+			fwrite(seq, 1, 2, out);
+			fwrite(video_broadcast_get_sent_frame(), 1, video_broadcast_frame_bytes(), out);
+		}
+		// Stdin closed ends it, otherwise this is the pause between two calls of loop()
+		struct pollfd p = { 0, POLLIN, 0 };
+		if(poll(&p, 1, 1) > 0){
+			char c;
+			if(read(0, &c, 1) <= 0) break;
+		}
+	}
+	const c3NetStats_t *st = c3NetGetStats();
+	fprintf(stderr, "c3netcheck: %u packets, %u bad, %u late, %u presented, %u dropped\n",
+		st->packets, st->badPackets, st->latePackets, st->presented, st->dropped);
+	c3NetEnd();
+	fclose(out);
+	free(back);
+	return 0;
+}
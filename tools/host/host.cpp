@@ -0,0 +1,256 @@
+/*
+	Implementation of the stand-ins in stubs/ for the host builds
+*/
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
+#include <esp8266_peri.h>
+#include <chrono>
+#include <thread>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+volatile uint32_t c3HostRegs[64];
+HardwareSerial Serial;
+EspClass ESP;
+
+static uint8_t cpuFreq = 80;
+
+static uint64_t nanos(){
+	static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+size_t Print::printf(const char *format, ...){
+	char buf[256];
+	va_list args;
+	va_start(args, format);
+	int n = vsnprintf(buf, sizeof(buf), format, args);
+	va_end(args);
+	if(n < 0) return 0;
+	if(n >= (int)sizeof(buf)) n = sizeof(buf) - 1;
+	for(int i = 0; i < n; i++) write(buf[i]);
+	return n;
+}
+
+size_t Print::print(const char *s){
+	size_t n = 0;
+	while(*s) n += write(*s++);
+	return n;
+}
+
+size_t Print::println(const char *s){
+	return print(s) + write('\n');
+}
+
+uint32_t EspClass::getCycleCount(){
+	return (uint32_t)(nanos() * cpuFreq / 1000);
+}
+
+uint32_t EspClass::getFreeHeap(){
+	return 40000;
+}
+
+unsigned long micros(){
+	return nanos() / 1000;
+}
+
+unsigned long millis(){
+	return nanos() / 1000000;
+}
+
+void delay(unsigned long ms){
+	std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield(){
+}
+
+void os_timer_setfn(os_timer_t *timer, os_timer_func_t *fn, void *arg){
+	timer->fn = fn;
+	timer->arg = arg;
+}
+
+void os_timer_arm(os_timer_t *, uint32_t, bool){
+}
+
+void os_timer_disarm(os_timer_t *){
+}
+
+uint8_t system_get_cpu_freq(){
+	return cpuFreq;
+}
+
+bool system_update_cpu_freq(uint8_t freq){
+	cpuFreq = freq;
+	return true;
+}
+
+void ets_isr_attach(int, void (*)(void*, void*), void *){
+}
+
+void ets_isr_mask(uint32_t){
+}
+
+void ets_isr_unmask(uint32_t){
+}
+
+// --- Network ---
+static int openSocket(int type, uint16_t port){
+	int fd = socket(AF_INET, type, 0);
+	if(fd < 0) return -1;
+	int on = 1;
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+	sockaddr_in a = {};
+	a.sin_family = AF_INET;
+	a.sin_port = htons(port);
+	a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if(bind(fd, (sockaddr*)&a, sizeof(a)) != 0 || (type == SOCK_STREAM && listen(fd, 1) != 0)){
+		close(fd);
+		return -1;
+	}
+	fcntl(fd, F_SETFL, O_NONBLOCK);
+	return fd;
+}
+
+uint8_t WiFiClient::connected(){
+	if(fd < 0) return 0;
+	uint8_t b;
+	// Data still waiting counts as connected, like on the ESP8266
+	ssize_t n = recv(fd, &b, 1, MSG_PEEK | MSG_DONTWAIT);
+	return n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+}
+
+int WiFiClient::available(){
+	int n = 0;
+	if(fd < 0 || ioctl(fd, FIONREAD, &n) != 0) return 0;
+	return n;
+}
+
+int WiFiClient::read(){
+	uint8_t b;
+	return (read(&b, 1) == 1)?b:-1;
+}
+
+int WiFiClient::read(uint8_t *buf, size_t len){
+	if(fd < 0) return -1;
+	ssize_t n = recv(fd, buf, len, MSG_DONTWAIT);
+	return (n < 0)?-1:(int)n;
+}
+
+size_t WiFiClient::write(uint8_t c){
+	return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t *buf, size_t len){
+	if(fd < 0) return 0;
+	ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+	return (n < 0)?0:n;
+}
+
+void WiFiClient::stop(){
+	if(fd >= 0) close(fd);
+	fd = -1;
+}
+
+void WiFiServer::begin(uint16_t p){
+	port = p;
+	fd = openSocket(SOCK_STREAM, port);
+}
+
+bool WiFiServer::hasClient(){
+	if(pending < 0 && fd >= 0) pending = accept(fd, NULL, NULL);
+	return pending >= 0;
+}
+
+WiFiClient WiFiServer::available(){
+	hasClient();
+	WiFiClient c(pending);
+	pending = -1;
+	return c;
+}
+
+void WiFiServer::stop(){
+	if(pending >= 0) close(pending);
+	if(fd >= 0) close(fd);
+	pending = -1;
+	fd = -1;
+}
+
+uint8_t WiFiUDP::begin(uint16_t port){
+	fd = openSocket(SOCK_DGRAM, port);
+	return fd >= 0;
+}
+
+void WiFiUDP::stop(){
+	if(fd >= 0) close(fd);
+	fd = -1;
+}
+
+int WiFiUDP::parsePacket(){
+	// The rest of the previous packet is dropped
+	len = pos = 0;
+	if(fd < 0) return 0;
+	sockaddr_in from = {};
+	socklen_t fromLen = sizeof(from);
+	ssize_t n = recvfrom(fd, packet, sizeof(packet), MSG_DONTWAIT, (sockaddr*)&from, &fromLen);
+	if(n <= 0) return 0;
+	len = n;
+	fromAddr = from.sin_addr.s_addr;
+	fromPort = ntohs(from.sin_port);
+	return len;
+}
+
+int WiFiUDP::available(){
+	return len - pos;
+}
+
+int WiFiUDP::read(){
+	return (pos < len)?packet[pos++]:-1;
+}
+
+int WiFiUDP::read(uint8_t *buf, size_t n){
+	if((int)n > len - pos) n = len - pos;
+	memcpy(buf, &packet[pos], n);
+	pos += n;
+	return n;
+}
+
+IPAddress WiFiUDP::remoteIP(){
+	return IPAddress(fromAddr);
+}
+
+uint16_t WiFiUDP::remotePort(){
+	return fromPort;
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port){
+	toAddr = ip.addr;
+	toPort = port;
+	out = 0;
+	return 1;
+}
+
+size_t WiFiUDP::write(uint8_t c){
+	return write(&c, 1);
+}
+
+size_t WiFiUDP::write(const uint8_t *buf, size_t n){
+	if(n > sizeof(reply) - out) n = sizeof(reply) - out;
+	memcpy(&reply[out], buf, n);
+	out += n;
+	return n;
+}
+
+int WiFiUDP::endPacket(){
+	sockaddr_in to = {};
+	to.sin_family = AF_INET;
+	to.sin_port = htons(toPort);
+	to.sin_addr.s_addr = toAddr;
+	return sendto(fd, reply, out, 0, (sockaddr*)&to, sizeof(to)) == out;
+}
@@ -0,0 +1,52 @@
+#ifndef C3_HOST_ARDUINO_H
+#define C3_HOST_ARDUINO_H
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include "c_types.h"
+#include "user_interface.h"
+#include "ets_sys.h"
+
+class Print {
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t c) = 0;
+	size_t printf(const char *format, ...);
+	size_t print(const char *s);
+	size_t println(const char *s = "");
+};
+
+/** @brief What the library reads packets from, see ESP8266WiFi.h and WiFiUdp.h */
+class Stream : public Print {
+public:
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int read(uint8_t *buf, size_t len) = 0;
+};
+
+/** @brief Serial writes to stdout */
+class HardwareSerial : public Print {
+public:
+	void begin(unsigned long) {}
+	size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+};
+extern HardwareSerial Serial;
+
+/** @brief The cycle counter is the time of a steady clock at system_get_cpu_freq() */
+class EspClass {
+public:
+	uint32_t getCycleCount();
+	uint32_t getFreeHeap();
+};
+extern EspClass ESP;
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+void yield();
+
+static inline uint32_t xt_rsil(uint32_t) { return 0; }
+static inline void xt_wsr_ps(uint32_t) {}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef C3_HOST_ESP8266WIFI_H
+#define C3_HOST_ESP8266WIFI_H
+
+#include "Arduino.h"
+
+/*
+	TCP over the sockets of the PC, non blocking like on the ESP8266, so net_ingest.cpp
+	can be run against tools/c3netsend.py on 127.0.0.1. Implemented in host.cpp.
+*/
+
+class IPAddress {
+public:
+	IPAddress() : addr(0) {}
+	explicit IPAddress(uint32_t a) : addr(a) {}
+	uint32_t addr;	// Network byte order
+};
+
+/** @brief A connection, copies share the socket, stop closes it */
+class WiFiClient : public Stream {
+public:
+	WiFiClient() : fd(-1) {}
+	explicit WiFiClient(int socket) : fd(socket) {}
+	uint8_t connected();
+	int available();
+	int read();
+	int read(uint8_t *buf, size_t len);
+	size_t write(uint8_t c);
+	size_t write(const uint8_t *buf, size_t len);
+	void stop();
+private:
+	int fd;
+};
+
+class WiFiServer {
+public:
+	explicit WiFiServer(uint16_t p) : fd(-1), pending(-1), port(p) {}
+	void begin(uint16_t port);
+	bool hasClient();
+	WiFiClient available();
+	void stop();
+private:
+	int fd;
+	int pending;	// Accepted by hasClient, handed out by available
+	uint16_t port;
+};
+
+#endif
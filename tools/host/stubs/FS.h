@@ -0,0 +1,9 @@
+#ifndef C3_HOST_FS_H
+#define C3_HOST_FS_H
+
+#include "c_types.h"
+
+/* Only declared, video_player.cpp is not built on the host */
+namespace fs { class File; }
+
+#endif
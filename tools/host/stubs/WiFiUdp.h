@@ -0,0 +1,35 @@
+#ifndef C3_HOST_WIFIUDP_H
+#define C3_HOST_WIFIUDP_H
+
+#include "ESP8266WiFi.h"
+
+/** @brief UDP over the sockets of the PC, one datagram is read at a time like on the ESP8266 */
+class WiFiUDP : public Stream {
+public:
+	WiFiUDP() : fd(-1), len(0), pos(0), out(0) {}
+	uint8_t begin(uint16_t port);
+	void stop();
+	int parsePacket();
+	int available();
+	int read();
+	int read(uint8_t *buf, size_t len);
+	IPAddress remoteIP();
+	uint16_t remotePort();
+	int beginPacket(IPAddress ip, uint16_t port);
+	size_t write(uint8_t c);
+	size_t write(const uint8_t *buf, size_t len);
+	int endPacket();
+private:
+	int fd;
+	uint8_t packet[1536];
+	int len;
+	int pos;
+	uint32_t fromAddr;
+	uint16_t fromPort;
+	uint8_t reply[1536];
+	int out;
+	uint32_t toAddr;
+	uint16_t toPort;
+};
+
+#endif
@@ -0,0 +1,37 @@
+/*
+	Host stand-ins for the ESP8266 SDK and Arduino core, just enough to build the
+	drawing and math code of the library on a PC. Nothing is sent, the registers
+	are plain memory and the video interrupt never runs.
+*/
+#ifndef C3_HOST_C_TYPES_H
+#define C3_HOST_C_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t uint8;
+typedef int8_t sint8;
+typedef uint16_t uint16;
+typedef int16_t sint16;
+typedef uint32_t uint32;
+typedef int32_t sint32;
+typedef int32_t int32;
+
+#define LOCAL static
+#define ICACHE_FLASH_ATTR
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+#define ICACHE_RODATA_ATTR
+#define PROGMEM
+
+#define pgm_read_byte(a) (*(const uint8_t*)(a))
+#define pgm_read_word(a) (*(const uint16_t*)(a))
+#define pgm_read_dword(a) (*(const uint32_t*)(a))
+#define memcpy_P memcpy
+#define ets_memcpy memcpy
+#define ets_memset memset
+
+#endif
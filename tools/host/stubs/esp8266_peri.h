@@ -0,0 +1,17 @@
+#ifndef C3_HOST_ESP8266_PERI_H
+#define C3_HOST_ESP8266_PERI_H
+
+#include "c_types.h"
+#include "ets_sys.h"
+
+/* Registers are words of a plain array, every name just needs some value */
+extern volatile uint32_t c3HostRegs[64];
+#define READ_PERI_REG(reg) c3HostRegs[(reg) & 63]
+#define WRITE_PERI_REG(reg, val) (c3HostRegs[(reg) & 63] = (val))
+#define SET_PERI_REG_MASK(reg, mask) (c3HostRegs[(reg) & 63] |= (mask))
+#define CLEAR_PERI_REG_MASK(reg, mask) (c3HostRegs[(reg) & 63] &= ~(mask))
+#define PIN_FUNC_SELECT(reg, func) ((void)0)
+#define i2c_writeReg_Mask_def(block, reg_add, indata) ((void)0)
+#define PERIPHS_IO_MUX_U0RXD_U 0u
+
+#endif
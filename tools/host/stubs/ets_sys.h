@@ -0,0 +1,11 @@
+#ifndef C3_HOST_ETS_SYS_H
+#define C3_HOST_ETS_SYS_H
+
+#include "c_types.h"
+
+#define ETS_SLC_INUM 1
+void ets_isr_attach(int num, void (*fn)(void*, void*), void *arg);
+void ets_isr_mask(uint32_t mask);
+void ets_isr_unmask(uint32_t mask);
+
+#endif
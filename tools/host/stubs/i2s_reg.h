@@ -0,0 +1,45 @@
+#ifndef C3_HOST_I2S_REG_H
+#define C3_HOST_I2S_REG_H
+
+#include "esp8266_peri.h"
+
+#define I2SCONF 1u
+#define I2SCONF_CHAN 2u
+#define I2SINT_CLR 3u
+#define I2SINT_ENA 4u
+#define I2S_BCK_DIV_NUM 5u
+#define I2S_BCK_DIV_NUM_S 6u
+#define I2S_BITS_MOD 7u
+#define I2S_BITS_MOD_S 8u
+#define I2S_CLKM_DIV_NUM 9u
+#define I2S_CLKM_DIV_NUM_S 10u
+#define I2S_FIFO_CONF 11u
+#define I2S_I2S_DSCR_EN 12u
+#define I2S_I2S_PUT_DATA_INT_CLR 13u
+#define I2S_I2S_RESET_MASK 14u
+#define I2S_I2S_RX_FIFO_MOD 15u
+#define I2S_I2S_RX_FIFO_MOD_S 16u
+#define I2S_I2S_RX_REMPTY_INT_ENA 17u
+#define I2S_I2S_RX_TAKE_DATA_INT_ENA 18u
+#define I2S_I2S_RX_WFULL_INT_CLR 19u
+#define I2S_I2S_TAKE_DATA_INT_CLR 20u
+#define I2S_I2S_TX_FIFO_MOD 21u
+#define I2S_I2S_TX_FIFO_MOD_S 22u
+#define I2S_I2S_TX_PUT_DATA_INT_ENA 23u
+#define I2S_I2S_TX_REMPTY_INT_CLR 24u
+#define I2S_I2S_TX_REMPTY_INT_ENA 25u
+#define I2S_I2S_TX_START 26u
+#define I2S_I2S_TX_WFULL_INT_CLR 27u
+#define I2S_I2S_TX_WFULL_INT_ENA 28u
+#define I2S_MSB_RIGHT 29u
+#define I2S_RECE_MSB_SHIFT 30u
+#define I2S_RECE_SLAVE_MOD 31u
+#define I2S_RIGHT_FIRST 32u
+#define I2S_RX_CHAN_MOD 33u
+#define I2S_RX_CHAN_MOD_S 3u
+#define I2S_TRANS_MSB_SHIFT 35u
+#define I2S_TRANS_SLAVE_MOD 36u
+#define I2S_TX_CHAN_MOD 37u
+#define I2S_TX_CHAN_MOD_S 0u
+
+#endif
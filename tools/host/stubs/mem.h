@@ -0,0 +1,6 @@
+#ifndef C3_HOST_MEM_H
+#define C3_HOST_MEM_H
+
+#include "c_types.h"
+
+#endif
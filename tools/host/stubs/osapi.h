@@ -0,0 +1,6 @@
+#ifndef C3_HOST_OSAPI_H
+#define C3_HOST_OSAPI_H
+
+#include "c_types.h"
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef C3_HOST_SLC_REGISTER_H
+#define C3_HOST_SLC_REGISTER_H
+
+#include "esp8266_peri.h"
+
+#define SLC_CONF0 1u
+#define SLC_INFOR_NO_REPLACE 2u
+#define SLC_INT_CLR 3u
+#define SLC_INT_ENA 4u
+#define SLC_INT_STATUS 5u
+#define SLC_MODE 6u
+#define SLC_MODE_S 7u
+#define SLC_RXLINK_DESCADDR_MASK 8u
+#define SLC_RXLINK_RST 9u
+#define SLC_RXLINK_START 10u
+#define SLC_RX_DSCR_CONF 11u
+#define SLC_RX_EOF_DES_ADDR 12u
+#define SLC_RX_EOF_INT_ENA 13u
+#define SLC_RX_EOF_INT_ST 14u
+#define SLC_RX_EOF_MODE 15u
+#define SLC_RX_FILL_EN 16u
+#define SLC_RX_FILL_MODE 17u
+#define SLC_RX_LINK 18u
+#define SLC_TOKEN_NO_REPLACE 19u
+#define SLC_TXLINK_DESCADDR_MASK 20u
+#define SLC_TXLINK_RST 21u
+#define SLC_TXLINK_START 22u
+#define SLC_TX_LINK 23u
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef C3_HOST_USER_INTERFACE_H
+#define C3_HOST_USER_INTERFACE_H
+
+#include "c_types.h"
+
+typedef void os_timer_func_t(void *arg);
+typedef struct { os_timer_func_t *fn; void *arg; } os_timer_t;
+
+void os_timer_setfn(os_timer_t *timer, os_timer_func_t *fn, void *arg);
+void os_timer_arm(os_timer_t *timer, uint32_t ms, bool repeat);
+void os_timer_disarm(os_timer_t *timer);
+
+#define SYS_CPU_80MHZ 80
+#define SYS_CPU_160MHZ 160
+uint8_t system_get_cpu_freq();
+bool system_update_cpu_freq(uint8_t freq);
+
+#endif
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""
+obj2mesh.py - Converts a Wavefront OBJ file into a flash resident tdMesh_t (see src/mesh.h).
+
+Positions are quantized to int16, or to int8 (--pos8) plus a common shift; the library
+decodes into int16, so 16 bit models have to fit without a shift. Indices are stored as
+uint8 when the mesh has at most 256 vertices and as uint16 otherwise, at most 65535
+vertices and edges fit. The wireframe is taken from the OBJ polygons, not the triangles.
+Every table is packed into 32 bit words so the ESP8266 can read it from flash in place.
+
+OBJ faces are counter-clockwise, the library expects front faces to run clockwise on
+screen, so the winding is flipped unless --keep-winding is given.
+
+Usage:
+    obj2mesh.py model.obj -n teapot -o teapot_mesh.h [--scale 100] [--pos8] [--no-edges] [--no-faces]
+"""
+import argparse
+import math
+import sys
+
+
+def load_obj(path):
+	"""Returns (vertices, polygons)."""
+	verts = []
+	polys = []
+	with open(path, "r") as f:
+		for line in f:
+			parts = line.split()
+			if not parts:
+				continue
+			if parts[0] == "v":
+				verts.append(tuple(float(p) for p in parts[1:4]))
+			elif parts[0] == "f":
+				idx = []
+				for p in parts[1:]:
+					i = int(p.split("/")[0])
+					idx.append(i - 1 if i > 0 else len(verts) + i)
+				polys.append(idx)
+	return verts, polys
+
+
+def triangulate(polys):
+	"""Splits every polygon into a fan of triangles."""
+	faces = []
+	for p in polys:
+		for k in range(1, len(p) - 1):
+			faces.append((p[0], p[k], p[k + 1]))
+	return faces
+
+
+def edges_from_polys(polys):
+	seen = set()
+	edges = []
+	for p in polys:
+		for k in range(len(p)):
+			a, b = p[k], p[(k + 1) % len(p)]
+			key = (min(a, b), max(a, b))
+			if key not in seen:
+				seen.add(key)
+				edges.append(key)
+	return edges
+
+
+def quantize(verts, scale, bits):
+	"""Returns (quantized vertices, shift) so that decoded = q << shift fits into int16."""
+	limit = (1 << (bits - 1)) - 1
+	scaled = [tuple(c * scale for c in v) for v in verts]
+	biggest = max([abs(c) for v in scaled for c in v] + [1])
+	shift = 0
+	while biggest / (1 << shift) > limit:
+		shift += 1
+	if shift > 16 - bits:
+		raise ValueError("model does not fit into int16, use a smaller --scale%s" % ("" if bits == 8 else " or --pos8"))
+	q = [tuple(max(-limit - 1, min(limit, int(round(c / (1 << shift))))) for c in v) for v in scaled]
+	return q, shift
+
+
+def bounding_sphere(qverts, shift):
+	dec = [tuple(c << shift for c in v) for v in qverts]
+	lo = [min(v[i] for v in dec) for i in range(3)]
+	hi = [max(v[i] for v in dec) for i in range(3)]
+	center = [(lo[i] + hi[i]) // 2 for i in range(3)]
+	radius = int(math.ceil(max(math.sqrt(sum((v[i] - center[i]) ** 2 for i in range(3))) for v in dec))) + 1
+	if radius > 32767:
+		raise ValueError("bounding radius %d does not fit into int16, use a smaller --scale" % radius)
+	return center, radius
+
+
+def pack_verts(qverts, pos16):
+	words = []
+	for x, y, z in qverts:
+		if pos16:
+			words.append((x & 0xffff) | ((y & 0xffff) << 16))
+			words.append(z & 0xffff)
+		else:
+			words.append((x & 0xff) | ((y & 0xff) << 8) | ((z & 0xff) << 16))
+	return words
+
+
+def pack_indices(indices, idx16):
+	per = 2 if idx16 else 4
+	bits = 16 if idx16 else 8
+	words = []
+	for i in range(0, len(indices), per):
+		w = 0
+		for k, v in enumerate(indices[i:i + per]):
+			w |= v << (k * bits)
+		words.append(w)
+	return words
+
+
+def c_words(name, words):
+	lines = ["static const uint32_t %s[] PROGMEM = {" % name]
+	for i in range(0, len(words), 8):
+		lines.append("\t" + ", ".join("0x%08x" % w for w in words[i:i + 8]) + ",")
+	lines.append("};")
+	return "\n".join(lines)
+
+
+def mesh_to_c(name, verts, polys, scale=1.0, pos8=False, with_edges=True, with_faces=True, keep_winding=False):
+	if len(verts) > 65535:
+		raise ValueError("%d vertices, at most 65535 fit" % len(verts))
+	faces = triangulate(polys)
+	if not keep_winding:
+		faces = [(a, c, b) for a, b, c in faces]
+	qverts, shift = quantize(verts, scale, 8 if pos8 else 16)
+	center, radius = bounding_sphere(qverts, shift)
+	idx16 = len(verts) > 256
+	edges = edges_from_polys(polys) if with_edges else []
+	if len(edges) > 65535 or len(faces) > 65535:
+		raise ValueError("%d edges and %d faces, at most 65535 of each fit" % (len(edges), len(faces)))
+	flags = []
+	if not pos8:
+		flags.append("TD_MESH_POS16")
+	if idx16:
+		flags.append("TD_MESH_IDX16")
+
+	out = ["// Generated by tools/obj2mesh.py, do not edit.", "#include <mesh.h>", ""]
+	out.append(c_words(name + "_verts", pack_verts(qverts, not pos8)))
+	if edges:
+		out.append(c_words(name + "_edges", pack_indices([i for e in edges for i in e], idx16)))
+	if with_faces and faces:
+		out.append(c_words(name + "_faces", pack_indices([i for f in faces for i in f], idx16)))
+	out.append("")
+	out.append("static const tdMesh_t %s = {" % name)
+	out.append("\t%s_verts, %s, %s," % (name, name + "_edges" if edges else "NULL",
+		name + "_faces" if with_faces and faces else "NULL"))
+	out.append("\t%d, %d, %d," % (len(verts), len(edges), len(faces) if with_faces else 0))
+	out.append("\t%s, %d," % (" | ".join(flags) if flags else "0", shift))
+	out.append("\t{ %d, %d, %d }, %d" % (center[0], center[1], center[2], radius))
+	out.append("};")
+	return "\n".join(out) + "\n"
+
+
+def main():
+	ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	ap.add_argument("obj")
+	ap.add_argument("-n", "--name", default="mesh", help="C identifier of the mesh")
+	ap.add_argument("-o", "--output", help="output header, stdout if omitted")
+	ap.add_argument("--scale", type=float, default=1.0, help="multiply all coordinates")
+	ap.add_argument("--pos8", action="store_true", help="store 8 bit positions (one word per vertex)")
+	ap.add_argument("--no-edges", action="store_true", help="omit the wireframe edge list")
+	ap.add_argument("--no-faces", action="store_true", help="omit the face list")
+	ap.add_argument("--keep-winding", action="store_true", help="do not flip the face winding")
+	args = ap.parse_args()
+
+	verts, polys = load_obj(args.obj)
+	if not verts:
+		sys.exit("no vertices in " + args.obj)
+	try:
+		text = mesh_to_c(args.name, verts, polys, args.scale, args.pos8,
+			not args.no_edges, not args.no_faces, args.keep_winding)
+	except ValueError as e:
+		sys.exit("%s: %s" % (args.obj, e))
+	if args.output:
+		with open(args.output, "w") as f:
+			f.write(text)
+	else:
+		sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+	main()